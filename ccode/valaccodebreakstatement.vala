@@ -27,7 +27,7 @@ using GLib;
  */
 public class Vala.CCodeBreakStatement : CCodeStatement {
 	public override void write (CCodeWriter writer) {
-		writer.write_indent (line);
+		writer.write_indent (this);
 		writer.write_string ("break;");
 		writer.write_newline ();
 	}
@@ -36,7 +36,7 @@ public class Vala.CCodeCaseStatement : CCodeStatement {
 	}
 	
 	public override void write (CCodeWriter writer) {
-		writer.write_indent (line);
+		writer.write_indent (this);
 		writer.write_string ("case ");
 		expression.write (writer);
 		writer.write_string (":");
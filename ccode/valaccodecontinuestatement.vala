@@ -27,7 +27,7 @@ using GLib;
  */
 public class Vala.CCodeContinueStatement : CCodeStatement {
 	public override void write (CCodeWriter writer) {
-		writer.write_indent (line);
+		writer.write_indent (this);
 		writer.write_string ("continue;");
 		writer.write_newline ();
 	}
@@ -72,7 +72,7 @@ public class Vala.CCodeDeclaration : CCodeStatement {
 	public override void write_declaration (CCodeWriter writer) {
 		if ((modifiers & (CCodeModifiers.STATIC | CCodeModifiers.INTERNAL | CCodeModifiers.EXTERN)) != 0) {
 			// combined declaration and initialization for static and extern variables
-			writer.write_indent (line);
+			writer.write_indent (this);
 			if ((modifiers & CCodeModifiers.INTERNAL) != 0) {
 				writer.write_string ("G_GNUC_INTERNAL ");
 			}
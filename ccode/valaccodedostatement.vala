@@ -42,7 +42,7 @@ public class Vala.CCodeDoStatement : CCodeStatement {
 	}
 	
 	public override void write (CCodeWriter writer) {
-		writer.write_indent (line);
+		writer.write_indent (this);
 		writer.write_string ("do");
 
 		/* while shouldn't be on a separate line */
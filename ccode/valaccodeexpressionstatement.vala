@@ -54,7 +54,7 @@ public class Vala.CCodeExpressionStatement : CCodeStatement {
 	}
 
 	private void write_expression (CCodeWriter writer, CCodeExpression? expr) {
-		writer.write_indent (line);
+		writer.write_indent (this);
 		if (expr != null) {
 			expr.write (writer);
 		}
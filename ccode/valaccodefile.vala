@@ -24,6 +24,13 @@
 public class Vala.CCodeFile {
 	public bool is_header { get; set; }
 
+	/**
+	 * Specifies whether definitions are written to an output buffer as
+	 * soon as they are added instead of being kept as code nodes until
+	 * the file is stored. Must not be combined with line directives.
+	 */
+	public bool stream_definitions { get; set; }
+
 	Set<string> declarations = new HashSet<string> (str_hash, str_equal);
 	Set<string> includes = new HashSet<string> (str_hash, str_equal);
 	CCodeFragment comments = new CCodeFragment ();
@@ -34,6 +41,9 @@ public class Vala.CCodeFile {
 	CCodeFragment constant_declaration = new CCodeFragment ();
 	CCodeFragment type_member_definition = new CCodeFragment ();
 
+	StringBuilder streamed_definitions;
+	CCodeWriter definition_writer;
+
 	public bool add_declaration (string name) {
 		if (name in declarations) {
 			return true;
@@ -70,7 +80,11 @@ public class Vala.CCodeFile {
 	}
 
 	public void add_type_member_definition (CCodeNode node) {
-		type_member_definition.append (node);
+		if (stream_definitions) {
+			write_definition (node);
+		} else {
+			type_member_definition.append (node);
+		}
 	}
 
 	public void add_function_declaration (CCodeFunction func) {
@@ -80,7 +94,19 @@ public class Vala.CCodeFile {
 	}
 
 	public void add_function (CCodeFunction func) {
-		type_member_definition.append (func);
+		if (stream_definitions) {
+			write_definition (func);
+		} else {
+			type_member_definition.append (func);
+		}
+	}
+
+	void write_definition (CCodeNode node) {
+		if (definition_writer == null) {
+			streamed_definitions = new StringBuilder ();
+			definition_writer = new CCodeWriter.for_buffer (streamed_definitions);
+		}
+		node.write (definition_writer);
 	}
 
 	public List<string> get_symbols () {
@@ -146,6 +172,9 @@ public class Vala.CCodeFile {
 			constant_declaration.write_combined (writer);
 			writer.write_newline ();
 			type_member_definition.write (writer);
+			if (streamed_definitions != null) {
+				writer.write_string (streamed_definitions.str);
+			}
 			writer.write_newline ();
 		} else {
 			writer.write_newline ();
@@ -179,9 +208,7 @@ public class Vala.CCodeFile {
 			once.write (writer);
 		}
 
-		writer.close ();
-
-		return true;
+		return writer.close ();
 	}
 }
 
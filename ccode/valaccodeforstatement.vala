@@ -65,7 +65,7 @@ public class Vala.CCodeForStatement : CCodeStatement {
 	public override void write (CCodeWriter writer) {
 		bool first;
 		
-		writer.write_indent (line);
+		writer.write_indent (this);
 		writer.write_string ("for (");
 		
 		first = true;
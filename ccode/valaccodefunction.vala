@@ -51,9 +51,14 @@ public class Vala.CCodeFunction : CCodeNode {
 	public CCodeBlock block { get; set; }
 
 	/**
-	 * The current line directive.
+	 * The source file name to be presumed for newly added statements.
 	 */
-	public CCodeLineDirective current_line { get; set; }
+	public weak string? current_line_filename { get; set; }
+
+	/**
+	 * The line number to be presumed for newly added statements.
+	 */
+	public int current_line_number { get; set; }
 
 	private List<CCodeParameter> parameters = new ArrayList<CCodeParameter> ();
 
@@ -111,7 +116,7 @@ public class Vala.CCodeFunction : CCodeNode {
 	}
 	
 	public override void write (CCodeWriter writer) {
-		writer.write_indent (line);
+		writer.write_indent (this);
 		if (CCodeModifiers.INTERNAL in modifiers) {
 			writer.write_string ("G_GNUC_INTERNAL ");
 		}
@@ -160,7 +165,8 @@ public class Vala.CCodeFunction : CCodeNode {
 	}
 
 	public void add_statement (CCodeNode stmt) {
-		stmt.line = current_line;
+		stmt.line_filename = current_line_filename;
+		stmt.line_number = current_line_number;
 		current_block.add_statement (stmt);
 	}
 
@@ -180,7 +186,8 @@ public class Vala.CCodeFunction : CCodeNode {
 		current_block = new CCodeBlock ();
 
 		var cif = new CCodeIfStatement (condition, current_block);
-		cif.line = current_line;
+		cif.line_filename = current_line_filename;
+		cif.line_number = current_line_number;
 		statement_stack.add (cif);
 
 		parent_block.add_statement (cif);
@@ -190,7 +197,8 @@ public class Vala.CCodeFunction : CCodeNode {
 		current_block = new CCodeBlock ();
 
 		var cif = (CCodeIfStatement) statement_stack[statement_stack.size - 1];
-		cif.line = current_line;
+		cif.line_filename = current_line_filename;
+		cif.line_number = current_line_number;
 		assert (cif.false_statement == null);
 		cif.false_statement = current_block;
 	}
@@ -204,7 +212,8 @@ public class Vala.CCodeFunction : CCodeNode {
 		current_block = new CCodeBlock ();
 
 		var cif = new CCodeIfStatement (condition, current_block);
-		cif.line = current_line;
+		cif.line_filename = current_line_filename;
+		cif.line_number = current_line_number;
 		parent_if.false_statement = cif;
 		statement_stack.add (cif);
 	}
@@ -216,7 +225,8 @@ public class Vala.CCodeFunction : CCodeNode {
 		current_block = new CCodeBlock ();
 
 		var cwhile = new CCodeWhileStatement (condition, current_block);
-		cwhile.line = current_line;
+		cwhile.line_filename = current_line_filename;
+		cwhile.line_number = current_line_number;
 		parent_block.add_statement (cwhile);
 	}
 
@@ -227,7 +237,8 @@ public class Vala.CCodeFunction : CCodeNode {
 		current_block = new CCodeBlock ();
 
 		var cfor = new CCodeForStatement (condition, current_block);
-		cfor.line = current_line;
+		cfor.line_filename = current_line_filename;
+		cfor.line_number = current_line_number;
 		if (initializer != null) {
 			cfor.add_initializer (initializer);
 		}
@@ -243,7 +254,8 @@ public class Vala.CCodeFunction : CCodeNode {
 		var parent_block = current_block;
 
 		var cswitch = new CCodeSwitchStatement (expression);
-		cswitch.line = current_line;
+		cswitch.line_filename = current_line_filename;
+		cswitch.line_number = current_line_number;
 		current_block = cswitch;
 
 		parent_block.add_statement (cswitch);
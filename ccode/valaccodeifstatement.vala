@@ -55,7 +55,7 @@ public class Vala.CCodeIfStatement : CCodeStatement {
 	
 	public override void write (CCodeWriter writer) {
 		if (!else_if) {
-			writer.write_indent (line);
+			writer.write_indent (this);
 		} else {
 			writer.write_string (" ");
 		}
@@ -31,21 +31,12 @@ public class Vala.CCodeLineDirective : CCodeNode {
 	 */
 	public string filename { get; set; }
 	
-	/**
-	 * The line number in the source file to be presumed.
-	 */
-	public int line_number { get; set; }
-	
 	public CCodeLineDirective (string _filename, int _line) {
 		filename = _filename;
 		line_number = _line;
 	}
 
 	public override void write (CCodeWriter writer) {
-		if (!writer.bol) {
-			writer.write_newline ();
-		}
-		writer.write_string ("#line %d \"%s\"".printf (line_number, filename));
-		writer.write_newline ();
+		writer.write_line_directive (filename, line_number);
 	}
 }
@@ -27,10 +27,16 @@ using GLib;
  */
 public abstract class Vala.CCodeNode {
 	/**
-	 * The source file name and line number to be presumed for this code
+	 * The source file name to be presumed for this code node. The string
+	 * is shared with the source file and not copied per node.
+	 */
+	public weak string? line_filename { get; set; }
+
+	/**
+	 * The line number in the source file to be presumed for this code
 	 * node.
 	 */
-	public CCodeLineDirective line { get; set; }
+	public int line_number { get; set; }
 
 	/**
 	 * Writes this code node and all children with the specified C code
@@ -40,6 +46,17 @@ public abstract class Vala.CCodeNode {
 	 */
 	public abstract void write (CCodeWriter writer);
 
+	/**
+	 * Copies the presumed source file name and line number of the
+	 * specified code node.
+	 *
+	 * @param node a C code node
+	 */
+	public void copy_line (CCodeNode node) {
+		line_filename = node.line_filename;
+		line_number = node.line_number;
+	}
+
 	/**
 	 * Writes declaration for this code node with the specified C code
 	 * writer if necessary.
@@ -36,7 +36,7 @@ public class Vala.CCodeReturnStatement : CCodeStatement {
 	}
 	
 	public override void write (CCodeWriter writer) {
-		writer.write_indent (line);
+		writer.write_indent (this);
 		writer.write_string ("return");
 	
 		if (return_expression != null) {
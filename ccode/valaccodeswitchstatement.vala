@@ -36,7 +36,7 @@ public class Vala.CCodeSwitchStatement : CCodeBlock {
 	}
 	
 	public override void write (CCodeWriter writer) {
-		writer.write_indent (line);
+		writer.write_indent (this);
 		writer.write_string ("switch (");
 		expression.write (writer);
 		writer.write_string (")");
@@ -88,7 +88,7 @@ public class Vala.CCodeVariableDeclarator : CCodeDeclarator {
 
 	public override void write_initialization (CCodeWriter writer) {
 		if (initializer != null && !init0) {
-			writer.write_indent (line);
+			writer.write_indent (this);
 
 			writer.write_string (name);
 			writer.write_string (" = ");
@@ -48,15 +48,16 @@ public class Vala.CCodeWriter {
 		get { return _bol; }
 	}
 
-	private string temp_filename;
-	private bool file_exists;
-
-	private FileStream? stream;
+	private StringBuilder buffer;
 	
 	private int indent;
 	private int current_line_number = 1;
 	private bool using_line_directive;
 
+	/* source position the C compiler presumes for the current line */
+	private weak string? presumed_filename;
+	private int presumed_line_number;
+
 	/* at begin of line */
 	private bool _bol = true;
 	
@@ -66,29 +67,25 @@ public class Vala.CCodeWriter {
 	}
 
 	/**
-	 * Opens the file.
+	 * Creates a writer that appends to the specified buffer instead of
+	 * writing to a file.
+	 *
+	 * @param buffer the buffer receiving the generated code
+	 */
+	public CCodeWriter.for_buffer (StringBuilder buffer) {
+		this.filename = "";
+		this.buffer = buffer;
+	}
+
+	/**
+	 * Opens the file. The generated code is kept in memory until the
+	 * writer is closed.
 	 *
 	 * @return true if the file has been opened successfully,
 	 *         false otherwise
 	 */
 	public bool open (bool write_version) {
-		file_exists = FileUtils.test (filename, FileTest.EXISTS);
-		if (file_exists) {
-			temp_filename = "%s.valatmp".printf (filename);
-			stream = FileStream.open (temp_filename, "w");
-		} else {
-			/*
-			 * File doesn't exist. In case of a particular destination (-d flag),
-			 * check and create the directory structure.
-			 */
-			var dirname = Path.get_dirname (filename);
-			DirUtils.create_with_parents (dirname, 0755);
-			stream = FileStream.open (filename, "w");
-		}
-
-		if (stream == null) {
-			return false;
-		}
+		buffer = new StringBuilder.sized (64 * 1024);
 
 		var opening = write_version ?
 			"/* %s generated by valac %s, the Vala compiler".printf (Path.get_basename (filename), Config.BUILD_VERSION) :
@@ -109,45 +106,53 @@ public class Vala.CCodeWriter {
 	}
 
 	/**
-	 * Closes the file.
+	 * Closes the file. The file is only written if its contents changed.
+	 *
+	 * @return true if the file has been written successfully or is
+	 *         already up to date, false otherwise
 	 */
-	public void close () {
-		stream = null;
-		
-		if (file_exists) {
-			var changed = true;
-
+	public bool close () {
+		if (FileUtils.test (filename, FileTest.EXISTS)) {
 			try {
 				var old_file = new MappedFile (filename, false);
-				var new_file = new MappedFile (temp_filename, false);
 				var len = old_file.get_length ();
-				if (len == new_file.get_length ()) {
-					if (Memory.cmp (old_file.get_contents (), new_file.get_contents (), len) == 0) {
-						changed = false;
+				if (len == (size_t) buffer.len) {
+					if (len == 0 || Memory.cmp (old_file.get_contents (), (void*) buffer.str, len) == 0) {
+						// leave file untouched to avoid triggering rebuilds
+						return true;
 					}
 				}
 				old_file = null;
-				new_file = null;
 			} catch (FileError e) {
 				// assume changed if mmap comparison doesn't work
 			}
-			
-			if (changed) {
-				FileUtils.rename (temp_filename, filename);
-			} else {
-				FileUtils.unlink (temp_filename);
-			}
+		} else {
+			/*
+			 * File doesn't exist. In case of a particular destination (-d flag),
+			 * check and create the directory structure.
+			 */
+			var dirname = Path.get_dirname (filename);
+			DirUtils.create_with_parents (dirname, 0755);
+		}
+
+		try {
+			FileUtils.set_contents (filename, buffer.str, buffer.len);
+		} catch (FileError e) {
+			return false;
 		}
+
+		return true;
 	}
 	
 	/**
 	 * Writes tabs according to the current indent level.
+	 *
+	 * @param node the code node whose source position should be presumed
 	 */
-	public void write_indent (CCodeLineDirective? line = null) {
+	public void write_indent (CCodeNode? node = null) {
 		if (line_directives) {
-			if (line != null) {
-				line.write (this);
-				using_line_directive = true;
+			if (node != null && node.line_filename != null) {
+				write_line_directive (node.line_filename, node.line_number);
 			} else if (using_line_directive) {
 				// no corresponding Vala line, emit line directive for C line
 				write_string ("#line %d \"%s\"".printf (current_line_number + 1, Path.get_basename (filename)));
@@ -161,19 +166,44 @@ public class Vala.CCodeWriter {
 		}
 		
 		for (int i = 0; i < indent; i++) {
-			stream.putc ('\t');
+			put_char ('\t');
 		}
 		
 		_bol = false;
 	}
 	
+	/**
+	 * Writes a line directive for the specified source position unless
+	 * the C compiler already presumes that position for the next line.
+	 *
+	 * @param filename    the name of the source file to be presumed
+	 * @param line_number the line number in the source file to be presumed
+	 */
+	public void write_line_directive (string filename, int line_number) {
+		if (!bol) {
+			write_newline ();
+		}
+		if (using_line_directive && line_number == presumed_line_number && filename == presumed_filename) {
+			return;
+		}
+		write_string ("#line %d \"%s\"".printf (line_number, filename));
+		write_newline ();
+		using_line_directive = true;
+		presumed_filename = filename;
+		presumed_line_number = line_number;
+	}
+
 	/**
 	 * Writes the specified string.
 	 *
 	 * @param s a string
 	 */
 	public void write_string (string s) {
-		stream.puts (s);
+		if (using_line_directive && s.index_of_char ('\n') >= 0) {
+			// line count no longer known, force next line directive
+			presumed_filename = null;
+		}
+		put_string (s);
 		_bol = false;
 	}
 	
@@ -181,8 +211,9 @@ public class Vala.CCodeWriter {
 	 * Writes a newline.
 	 */
 	public void write_newline () {
-		stream.putc ('\n');
+		put_char ('\n');
 		current_line_number++;
+		presumed_line_number++;
 		_bol = true;
 	}
 	
@@ -191,11 +222,11 @@ public class Vala.CCodeWriter {
 	 */
 	public void write_begin_block () {
 		if (!bol) {
-			stream.putc (' ');
+			put_char (' ');
 		} else {
 			write_indent ();
 		}
-		stream.putc ('{');
+		put_char ('{');
 		write_newline ();
 		indent++;
 	}
@@ -208,7 +239,7 @@ public class Vala.CCodeWriter {
 		
 		indent--;
 		write_indent ();
-		stream.putc ('}');
+		put_char ('}');
 	}
 	
 	/**
@@ -219,7 +250,7 @@ public class Vala.CCodeWriter {
 	public void write_comment (string text) {
 		try {
 			write_indent ();
-			stream.puts ("/*");
+			put_string ("/*");
 			bool first = true;
 
 			// discard tabs at beginning of line
@@ -238,16 +269,24 @@ public class Vala.CCodeWriter {
 				var lineparts = regex.replace_literal (line, -1, 0, "").split ("*/");
 
 				for (int i = 0; lineparts[i] != null; i++) {
-					stream.puts (lineparts[i]);
+					put_string (lineparts[i]);
 					if (lineparts[i+1] != null) {
-						stream.puts ("* /");
+						put_string ("* /");
 					}
 				}
 			}
-			stream.puts ("*/");
+			put_string ("*/");
 			write_newline ();
 		} catch (RegexError e) {
 			// ignore
 		}
 	}
+
+	void put_char (char c) {
+		buffer.append_c (c);
+	}
+
+	void put_string (string s) {
+		buffer.append (s);
+	}
 }
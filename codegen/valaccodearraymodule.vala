@@ -653,6 +653,155 @@ public class Vala.CCodeArrayModule : CCodeMethodCallModule {
 		return add_func;
 	}
 
+	string generate_array_reserve_wrapper (ArrayType array_type) {
+		string reserve_func = "_vala_array_reserve%d".printf (++next_array_add_id);
+
+		if (!add_wrapper (reserve_func)) {
+			// wrapper already defined
+			return reserve_func;
+		}
+
+		var function = new CCodeFunction (reserve_func, "void");
+		function.modifiers = CCodeModifiers.STATIC;
+
+		function.add_parameter (new CCodeParameter ("array", get_ccode_name (array_type) + "*"));
+		function.add_parameter (new CCodeParameter ("size", "int*"));
+		function.add_parameter (new CCodeParameter ("capacity", "int"));
+
+		push_function (function);
+
+		var array = new CCodeUnaryExpression (CCodeUnaryOperator.POINTER_INDIRECTION, new CCodeIdentifier ("array"));
+		var size = new CCodeUnaryExpression (CCodeUnaryOperator.POINTER_INDIRECTION, new CCodeIdentifier ("size"));
+
+		var renew_call = new CCodeFunctionCall (new CCodeIdentifier ("g_renew"));
+		renew_call.add_argument (new CCodeIdentifier (get_ccode_name (array_type.element_type)));
+		renew_call.add_argument (array);
+		if (array_type.element_type.is_reference_type_or_type_parameter ()) {
+			// NULL terminate array
+			renew_call.add_argument (new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, size, new CCodeConstant ("1")));
+		} else {
+			renew_call.add_argument (size);
+		}
+
+		ccode.open_if (new CCodeBinaryExpression (CCodeBinaryOperator.GREATER_THAN, new CCodeIdentifier ("capacity"), size));
+		ccode.add_assignment (size, new CCodeIdentifier ("capacity"));
+		ccode.add_assignment (array, renew_call);
+		ccode.close ();
+
+		pop_function ();
+
+		cfile.add_function_declaration (function);
+		cfile.add_function (function);
+
+		return reserve_func;
+	}
+
+	string generate_array_append_wrapper (ArrayType array_type) {
+		string append_func = "_vala_array_append%d".printf (++next_array_add_id);
+
+		if (!add_wrapper (append_func)) {
+			// wrapper already defined
+			return append_func;
+		}
+
+		var function = new CCodeFunction (append_func, "void");
+		function.modifiers = CCodeModifiers.STATIC;
+
+		function.add_parameter (new CCodeParameter ("array", get_ccode_name (array_type) + "*"));
+		function.add_parameter (new CCodeParameter ("length", "int*"));
+		function.add_parameter (new CCodeParameter ("size", "int*"));
+		function.add_parameter (new CCodeParameter ("values", get_ccode_name (array_type)));
+		function.add_parameter (new CCodeParameter ("values_length", "int"));
+		if (array_type.element_type is GenericType && array_type.element_type.value_owned && requires_copy (array_type.element_type)) {
+			// dup function array elements
+			string func_name = "%s_dup_func".printf (array_type.element_type.type_parameter.name.down ());
+			function.add_parameter (new CCodeParameter (func_name, "GBoxedCopyFunc"));
+		}
+
+		push_context (new EmitContext ());
+		push_function (function);
+
+		var array = new CCodeUnaryExpression (CCodeUnaryOperator.POINTER_INDIRECTION, new CCodeIdentifier ("array"));
+		var length = new CCodeUnaryExpression (CCodeUnaryOperator.POINTER_INDIRECTION, new CCodeIdentifier ("length"));
+		var size = new CCodeUnaryExpression (CCodeUnaryOperator.POINTER_INDIRECTION, new CCodeIdentifier ("size"));
+		var required = new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, length, new CCodeIdentifier ("values_length"));
+
+		var renew_call = new CCodeFunctionCall (new CCodeIdentifier ("g_renew"));
+		renew_call.add_argument (new CCodeIdentifier (get_ccode_name (array_type.element_type)));
+		renew_call.add_argument (array);
+		if (array_type.element_type.is_reference_type_or_type_parameter ()) {
+			// NULL terminate array
+			renew_call.add_argument (new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, size, new CCodeConstant ("1")));
+		} else {
+			renew_call.add_argument (size);
+		}
+
+		// grow at most once, keeping the amortized doubling of single adds
+		ccode.open_if (new CCodeBinaryExpression (CCodeBinaryOperator.GREATER_THAN, required, size));
+
+		// values may point into the block about to be renewed, e.g. a.append (a)
+		var values = new CCodeIdentifier ("values");
+		var values_offset = new CCodeIdentifier ("values_offset");
+		ccode.add_declaration ("int", new CCodeVariableDeclarator ("values_offset", new CCodeConstant ("-1")));
+		var in_array = new CCodeBinaryExpression (CCodeBinaryOperator.AND,
+		                                          new CCodeBinaryExpression (CCodeBinaryOperator.GREATER_THAN_OR_EQUAL, values, array),
+		                                          new CCodeBinaryExpression (CCodeBinaryOperator.LESS_THAN, values, new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, array, length)));
+		ccode.open_if (in_array);
+		ccode.add_assignment (values_offset, new CCodeBinaryExpression (CCodeBinaryOperator.MINUS, values, array));
+		ccode.close ();
+
+		var cmax = new CCodeFunctionCall (new CCodeIdentifier ("MAX"));
+		cmax.add_argument (new CCodeBinaryExpression (CCodeBinaryOperator.MUL, new CCodeConstant ("2"), size));
+		cmax.add_argument (required);
+		ccode.add_assignment (size, cmax);
+		ccode.add_assignment (array, renew_call);
+
+		ccode.open_if (new CCodeBinaryExpression (CCodeBinaryOperator.GREATER_THAN_OR_EQUAL, values_offset, new CCodeConstant ("0")));
+		ccode.add_assignment (values, new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, array, values_offset));
+		ccode.close ();
+
+		ccode.close ();
+
+		if (array_type.element_type.value_owned && requires_copy (array_type.element_type)) {
+			ccode.add_declaration ("int", new CCodeVariableDeclarator ("i"));
+
+			ccode.open_for (new CCodeAssignment (new CCodeIdentifier ("i"), new CCodeConstant ("0")),
+			                   new CCodeBinaryExpression (CCodeBinaryOperator.LESS_THAN, new CCodeIdentifier ("i"), new CCodeIdentifier ("values_length")),
+			                   new CCodeUnaryExpression (CCodeUnaryOperator.POSTFIX_INCREMENT, new CCodeIdentifier ("i")));
+
+			var element = new GLibValue (array_type.element_type, new CCodeElementAccess (new CCodeIdentifier ("values"), new CCodeIdentifier ("i")), true);
+			ccode.add_assignment (new CCodeElementAccess (array, new CCodeUnaryExpression (CCodeUnaryOperator.POSTFIX_INCREMENT, length)), get_cvalue_ (copy_value (element, array_type)));
+			ccode.close ();
+		} else {
+			cfile.add_include ("string.h");
+
+			var sizeof_call = new CCodeFunctionCall (new CCodeIdentifier ("sizeof"));
+			sizeof_call.add_argument (new CCodeIdentifier (get_ccode_name (array_type.element_type)));
+
+			var copy_call = new CCodeFunctionCall (new CCodeIdentifier ("memcpy"));
+			copy_call.add_argument (new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, array, length));
+			copy_call.add_argument (new CCodeIdentifier ("values"));
+			copy_call.add_argument (new CCodeBinaryExpression (CCodeBinaryOperator.MUL, new CCodeIdentifier ("values_length"), sizeof_call));
+			ccode.add_expression (copy_call);
+
+			ccode.add_assignment (length, required);
+		}
+
+		if (array_type.element_type.is_reference_type_or_type_parameter ()) {
+			// NULL terminate array
+			ccode.add_assignment (new CCodeElementAccess (array, length), new CCodeConstant ("NULL"));
+		}
+
+		pop_function ();
+
+		cfile.add_function_declaration (function);
+		cfile.add_function (function);
+
+		pop_context ();
+
+		return append_func;
+	}
+
 	bool is_array_add (Assignment assignment) {
 		var binary = assignment.right as BinaryExpression;
 		if (binary != null && binary.left.value_type is ArrayType) {
@@ -698,6 +847,48 @@ public class Vala.CCodeArrayModule : CCodeMethodCallModule {
 		ccode.add_expression (ccall);
 	}
 
+	public override void visit_method_call (MethodCall expr) {
+		var ma = expr.call as MemberAccess;
+		if (ma == null || !(ma.symbol_reference is ArrayReserveMethod || ma.symbol_reference is ArrayAppendMethod)) {
+			base.visit_method_call (expr);
+			return;
+		}
+
+		var array = ma.inner;
+		var array_type = (ArrayType) array.value_type;
+		var arg = expr.get_argument_list ()[0];
+
+		// the capacity is only tracked for these variables
+		var array_var = array.symbol_reference;
+		if (array_type.rank == 1 && array_var != null && array_var.is_internal_symbol ()
+		    && (array_var is LocalVariable || array_var is Field)) {
+			// valid array variable
+		} else {
+			Report.error (expr.source_reference, "`%s' not supported for public array variables and parameters".printf (ma.member_name));
+			return;
+		}
+
+		CCodeFunctionCall ccall;
+		if (ma.symbol_reference is ArrayReserveMethod) {
+			ccall = new CCodeFunctionCall (new CCodeIdentifier (generate_array_reserve_wrapper (array_type)));
+			ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, get_cvalue (array)));
+			ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, get_array_size_cvalue (array.target_value)));
+			ccall.add_argument (get_cvalue (arg));
+		} else {
+			ccall = new CCodeFunctionCall (new CCodeIdentifier (generate_array_append_wrapper (array_type)));
+			ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, get_cvalue (array)));
+			ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, get_array_length_cexpression (array)));
+			ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, get_array_size_cvalue (array.target_value)));
+			ccall.add_argument (get_cvalue (arg));
+			ccall.add_argument (get_array_length_cexpression (arg));
+			if (array_type.element_type is GenericType && array_type.element_type.value_owned && requires_copy (array_type.element_type)) {
+				ccall.add_argument (get_dup_func_expression (array_type.element_type, expr.source_reference));
+			}
+		}
+
+		ccode.add_expression (ccall);
+	}
+
 	public override CCodeParameter generate_parameter (Parameter param, CCodeFile decl_space, Map<int,CCodeParameter> cparam_map, Map<int,CCodeExpression>? carg_map) {
 		if (!(param.variable_type is ArrayType)) {
 			return base.generate_parameter (param, decl_space, cparam_map, carg_map);
@@ -75,6 +75,117 @@ public class Vala.CCodeAssignmentModule : CCodeMemberAccessModule {
 		}
 	}
 
+	TargetValue emit_string_append (Assignment assignment) {
+		var local = (LocalVariable) assignment.left.symbol_reference;
+		var binary = (BinaryExpression) assignment.right;
+
+		var ccall = new CCodeFunctionCall (new CCodeIdentifier (generate_string_append_wrapper ()));
+		ccall.add_argument (get_cvalue (assignment.left));
+		ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, get_variable_cexpression (get_string_length_cname (get_local_cname (local)))));
+		ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, get_variable_cexpression (get_string_size_cname (get_local_cname (local)))));
+		ccall.add_argument (get_cvalue (binary.right));
+		ccode.add_assignment (get_cvalue (assignment.left), ccall);
+
+		return store_temp_value (assignment.left.target_value, assignment);
+	}
+
+	string generate_string_append_wrapper () {
+		string append_func = "_vala_string_append";
+
+		if (!add_wrapper (append_func)) {
+			// wrapper already defined
+			return append_func;
+		}
+
+		cfile.add_include ("string.h");
+
+		var function = new CCodeFunction (append_func, "gchar*");
+		function.modifiers = CCodeModifiers.STATIC;
+
+		function.add_parameter (new CCodeParameter ("self", "gchar*"));
+		function.add_parameter (new CCodeParameter ("length", "gsize*"));
+		function.add_parameter (new CCodeParameter ("size", "gsize*"));
+		function.add_parameter (new CCodeParameter ("str", "const gchar*"));
+
+		push_function (function);
+
+		var self = new CCodeIdentifier ("self");
+		var str = new CCodeIdentifier ("str");
+		var str_length = new CCodeIdentifier ("str_length");
+		var offset = new CCodeIdentifier ("offset");
+		var length = new CCodeUnaryExpression (CCodeUnaryOperator.POINTER_INDIRECTION, new CCodeIdentifier ("length"));
+		var size = new CCodeUnaryExpression (CCodeUnaryOperator.POINTER_INDIRECTION, new CCodeIdentifier ("size"));
+
+		ccode.add_declaration ("gsize", new CCodeVariableDeclarator ("str_length"));
+
+		// same result as g_strconcat for null strings
+		var cnullcheck = new CCodeBinaryExpression (CCodeBinaryOperator.OR,
+			new CCodeBinaryExpression (CCodeBinaryOperator.EQUALITY, self, new CCodeConstant ("NULL")),
+			new CCodeBinaryExpression (CCodeBinaryOperator.EQUALITY, str, new CCodeConstant ("NULL")));
+		ccode.open_if (cnullcheck);
+		ccode.add_return (self);
+		ccode.close ();
+
+		// buffer was not allocated here, exact size is the only safe assumption
+		ccode.open_if (new CCodeBinaryExpression (CCodeBinaryOperator.EQUALITY, size, new CCodeConstant ("0")));
+		var cstrlen = new CCodeFunctionCall (new CCodeIdentifier ("strlen"));
+		cstrlen.add_argument (self);
+		ccode.add_assignment (length, cstrlen);
+		ccode.add_assignment (size, new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, length, new CCodeConstant ("1")));
+		ccode.close ();
+
+		cstrlen = new CCodeFunctionCall (new CCodeIdentifier ("strlen"));
+		cstrlen.add_argument (str);
+		ccode.add_assignment (str_length, cstrlen);
+
+		var required_size = new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, length, str_length), new CCodeConstant ("1"));
+		ccode.open_if (new CCodeBinaryExpression (CCodeBinaryOperator.GREATER_THAN, required_size, size));
+
+		// str may point into the buffer that is about to be reallocated
+		ccode.add_declaration ("gssize", new CCodeVariableDeclarator ("offset", new CCodeConstant ("-1")));
+		var caliascheck = new CCodeBinaryExpression (CCodeBinaryOperator.AND,
+			new CCodeBinaryExpression (CCodeBinaryOperator.GREATER_THAN_OR_EQUAL, str, self),
+			new CCodeBinaryExpression (CCodeBinaryOperator.LESS_THAN_OR_EQUAL, str, new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, self, length)));
+		ccode.open_if (caliascheck);
+		ccode.add_assignment (offset, new CCodeBinaryExpression (CCodeBinaryOperator.MINUS, str, self));
+		ccode.close ();
+
+		// double the size to amortize the cost of reallocation
+		var cmax = new CCodeFunctionCall (new CCodeIdentifier ("MAX"));
+		cmax.add_argument (new CCodeBinaryExpression (CCodeBinaryOperator.MUL, new CCodeConstant ("2"), size));
+		cmax.add_argument (required_size);
+		ccode.add_assignment (size, cmax);
+
+		var crealloc = new CCodeFunctionCall (new CCodeIdentifier ("g_realloc"));
+		crealloc.add_argument (self);
+		crealloc.add_argument (size);
+		ccode.add_assignment (self, crealloc);
+
+		ccode.open_if (new CCodeBinaryExpression (CCodeBinaryOperator.GREATER_THAN_OR_EQUAL, offset, new CCodeConstant ("0")));
+		ccode.add_assignment (str, new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, self, offset));
+		ccode.close ();
+
+		ccode.close ();
+
+		// memmove as str may overlap the terminating nul character
+		var cmove = new CCodeFunctionCall (new CCodeIdentifier ("memmove"));
+		cmove.add_argument (new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, self, length));
+		cmove.add_argument (str);
+		cmove.add_argument (new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, str_length, new CCodeConstant ("1")));
+		ccode.add_expression (cmove);
+
+		ccode.add_assignment (length, new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, length, str_length));
+
+		ccode.add_return (self);
+
+		pop_function ();
+
+		cfile.add_function_declaration (function);
+		cfile.add_function (function);
+
+		return append_func;
+	}
+
 	public override void visit_assignment (Assignment assignment) {
 		if (assignment.left.error || assignment.right.error) {
 			assignment.error = true;
@@ -89,6 +200,8 @@ public class Vala.CCodeAssignmentModule : CCodeMemberAccessModule {
 			assignment.target_value = assignment.right.target_value;
 		} else if (assignment.left.symbol_reference is Variable && is_simple_struct_creation ((Variable) assignment.left.symbol_reference, assignment.right)) {
 			// delegate to visit_object_creation_expression
+		} else if (assignment.is_string_append ()) {
+			assignment.target_value = emit_string_append (assignment);
 		} else {
 			assignment.target_value = emit_simple_assignment (assignment);
 		}
@@ -169,6 +282,11 @@ public class Vala.CCodeAssignmentModule : CCodeMemberAccessModule {
 		}
 
 		store_value (get_local_cvalue (local), value);
+
+		if (!initializer && local.is_appendable_string ()) {
+			// the new value was not allocated by _vala_string_append
+			ccode.add_assignment (get_variable_cexpression (get_string_size_cname (get_local_cname (local))), new CCodeConstant ("0"));
+		}
 	}
 
 	public override void store_parameter (Parameter param, TargetValue _value, bool capturing_parameter = false) {
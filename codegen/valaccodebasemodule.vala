@@ -65,9 +65,9 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 
 	List<EmitContext> emit_context_stack = new ArrayList<EmitContext> ();
 
-	public CCodeLineDirective? current_line = null;
+	public SourceReference? current_line = null;
 
-	List<CCodeLineDirective> line_directive_stack = new ArrayList<CCodeLineDirective> ();
+	List<SourceReference?> line_directive_stack = new ArrayList<SourceReference?> ();
 
 	public Symbol current_symbol { get { return emit_context.current_symbol; } }
 
@@ -202,6 +202,219 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 		}
 	}
 
+	/**
+	 * Returns whether the closure data of the specified captured block
+	 * can be stored on the stack instead of being reference counted.
+	 */
+	public bool is_stack_allocated_block (Block b) {
+		if (b.escaping) {
+			return false;
+		}
+
+		// the stack frame of coroutines does not persist across yields
+		unowned Symbol sym = b.parent_symbol;
+		while (sym is Block) {
+			sym = sym.parent_symbol;
+		}
+		var m = sym as Method;
+		return m == null || !m.coroutine;
+	}
+
+	/**
+	 * Returns whether the specified method is emitted as an unchecked
+	 * internal function, wrapped by a public function that performs
+	 * the argument checks.
+	 */
+	public bool has_unchecked_entry_point (Method m) {
+		if (!context.assert || m.external || m.external_package || m.body == null) {
+			return false;
+		}
+		if (m.is_private_symbol () || m.entry_point || m.closure || m.coroutine) {
+			return false;
+		}
+		if (m is CreationMethod || m.is_abstract || m.is_virtual || m.overrides || m.base_interface_method != null) {
+			return false;
+		}
+		if (m.signal_reference != null || m.is_async_callback || m.is_variadic () || is_header_inline_method (m)) {
+			return false;
+		}
+
+		// only worth it if the public function checks anything
+		if (m.binding == MemberBinding.INSTANCE && m.parent_symbol is Class) {
+			return true;
+		}
+		foreach (Parameter param in m.get_parameters ()) {
+			if (param.direction == ParameterDirection.OUT) {
+				continue;
+			}
+			var t = param.variable_type.data_type;
+			if (t != null && (t.is_reference_type () || param.variable_type.is_real_struct_type ())) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	public string get_unchecked_cname (Method m) {
+		return "%s_unchecked".printf (get_ccode_name (m));
+	}
+
+	/**
+	 * Returns whether the specified automatic property may be accessed
+	 * through its backing field at the specified node.
+	 */
+	public bool is_direct_property_access (Property prop, CodeNode node) {
+		if (prop.binding != MemberBinding.INSTANCE || prop.field == null || prop is DynamicProperty) {
+			return false;
+		}
+		if (prop.is_abstract || prop.is_virtual || prop.base_property != null || prop.base_interface_property != null) {
+			return false;
+		}
+		if (prop.external || prop.external_package || prop.property_type is ArrayType || prop.property_type is DelegateType) {
+			return false;
+		}
+		var cl = prop.parent_symbol as Class;
+		if (cl == null || cl.is_compact) {
+			return false;
+		}
+
+		// the private struct is only defined in the source file of the class
+		return prop.source_reference != null && node.source_reference != null &&
+		       prop.source_reference.file == node.source_reference.file;
+	}
+
+	/**
+	 * Returns whether calls of the specified virtual method may bypass
+	 * the class vtable as no subclass is able to override it.
+	 */
+	public bool is_final_method (Method m) {
+		if (!(m.is_virtual || m.overrides) || m.overridden || m.body == null) {
+			return false;
+		}
+		if (m.external || m.external_package || m.coroutine || m.signal_reference != null || m.base_interface_method != null) {
+			return false;
+		}
+
+		// subclasses outside of this compilation must not exist
+		var cl = m.parent_symbol as Class;
+		if (cl == null) {
+			return false;
+		}
+		return context.whole_program || cl.is_private_symbol () || (context.hide_internal && cl.is_internal_symbol ());
+	}
+
+	/**
+	 * Returns whether the specified method requested to be defined in
+	 * the header and is small and self-contained enough to be defined as
+	 * static inline function there instead of the source file.
+	 */
+	public bool is_header_inline_method (Method m) {
+		if (!get_ccode_header_inline (m) || m.is_private_symbol () || m.external || m.external_package || m.body == null) {
+			return false;
+		}
+		if (m is CreationMethod || m.is_abstract || m.is_virtual || m.overrides || m.base_interface_method != null) {
+			return false;
+		}
+		if (m.coroutine || m.closure || m.entry_point || m.signal_reference != null || m.is_variadic ()) {
+			return false;
+		}
+		if (m.get_type_parameters ().size > 0 || m.get_error_types ().size > 0
+		    || m.get_preconditions ().size > 0 || m.get_postconditions ().size > 0) {
+			return false;
+		}
+		if (!(m.return_type is VoidType) && !is_inline_value_type (m.return_type)) {
+			return false;
+		}
+		foreach (Parameter param in m.get_parameters ()) {
+			if (param.direction != ParameterDirection.IN || !is_inline_value_type (param.variable_type)) {
+				return false;
+			}
+		}
+
+		// a few field assignments, optionally followed by a return
+		var statements = m.body.get_statements ();
+		if (statements.size == 0 || statements.size > 3) {
+			return false;
+		}
+		for (int i = 0; i < statements.size; i++) {
+			var ret = statements[i] as ReturnStatement;
+			if (ret != null) {
+				if (i != statements.size - 1 || ret.return_expression == null || !is_inline_expression (ret.return_expression)) {
+					return false;
+				}
+				continue;
+			}
+			var stmt = statements[i] as ExpressionStatement;
+			if (stmt == null || !(stmt.expression is Assignment)) {
+				return false;
+			}
+			var assignment = (Assignment) stmt.expression;
+			if (!is_inline_expression (assignment.left) || !is_inline_expression (assignment.right)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool is_inline_value_type (DataType type) {
+		if (!(type is ValueType) || type.nullable) {
+			return false;
+		}
+		return type.data_type is Enum || (type.data_type is Struct && ((Struct) type.data_type).is_simple_type ());
+	}
+
+	// expressions that do not depend on anything the header cannot see
+	bool is_inline_expression (Expression expr) {
+		if (expr.value_type == null || !is_inline_value_type (expr.value_type)) {
+			return false;
+		}
+
+		if (expr is IntegerLiteral || expr is RealLiteral || expr is BooleanLiteral || expr is CharacterLiteral) {
+			return true;
+		} else if (expr is MemberAccess) {
+			var ma = (MemberAccess) expr;
+			if (ma.symbol_reference is Parameter) {
+				return ma.inner == null;
+			}
+			var f = ma.symbol_reference as Field;
+			if (f == null || f.binding != MemberBinding.INSTANCE) {
+				return false;
+			}
+			// private fields of classes are stored in the private struct
+			var cl = f.parent_symbol as Class;
+			if (cl != null && !cl.is_compact && f.access == SymbolAccessibility.PRIVATE) {
+				return false;
+			}
+			var inner = ma.inner as MemberAccess;
+			return inner != null && inner.inner == null && inner.symbol_reference is Parameter && inner.symbol_reference.name == "this";
+		} else if (expr is UnaryExpression) {
+			var unary = (UnaryExpression) expr;
+			switch (unary.operator) {
+			case UnaryOperator.PLUS:
+			case UnaryOperator.MINUS:
+			case UnaryOperator.LOGICAL_NEGATION:
+			case UnaryOperator.BITWISE_COMPLEMENT:
+				return is_inline_expression (unary.inner);
+			default:
+				return false;
+			}
+		} else if (expr is BinaryExpression) {
+			var binary = (BinaryExpression) expr;
+			if (binary.operator == BinaryOperator.IN || binary.operator == BinaryOperator.COALESCE) {
+				return false;
+			}
+			if (binary.operator == BinaryOperator.MOD && binary.value_type.data_type is Struct && ((Struct) binary.value_type.data_type).is_floating_type ()) {
+				// fmod requires math.h
+				return false;
+			}
+			return is_inline_expression (binary.left) && is_inline_expression (binary.right);
+		} else if (expr is CastExpression) {
+			var cast = (CastExpression) expr;
+			return !cast.is_silent_cast && is_inline_expression (cast.inner);
+		}
+		return false;
+	}
+
 	public unowned Block? next_closure_block (Symbol sym) {
 		while (true) {
 			unowned Method method = sym as Method;
@@ -553,7 +766,7 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 
 		this.emit_context = emit_context;
 		if (ccode != null) {
-			ccode.current_line = current_line;
+			update_ccode_line ();
 		}
 	}
 
@@ -562,7 +775,7 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 			this.emit_context = emit_context_stack[emit_context_stack.size - 1];
 			emit_context_stack.remove_at (emit_context_stack.size - 1);
 			if (ccode != null) {
-				ccode.current_line = current_line;
+				update_ccode_line ();
 			}
 		} else {
 			this.emit_context = null;
@@ -572,9 +785,9 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 	public void push_line (SourceReference? source_reference) {
 		line_directive_stack.add (current_line);
 		if (source_reference != null) {
-			current_line = new CCodeLineDirective (source_reference.file.filename, source_reference.begin.line);
+			current_line = source_reference;
 			if (ccode != null) {
-				ccode.current_line = current_line;
+				update_ccode_line ();
 			}
 		}
 	}
@@ -583,21 +796,32 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 		current_line = line_directive_stack[line_directive_stack.size - 1];
 		line_directive_stack.remove_at (line_directive_stack.size - 1);
 		if (ccode != null) {
-			ccode.current_line = current_line;
+			update_ccode_line ();
 		}
 	}
 
 	public void push_function (CCodeFunction func) {
 		emit_context.ccode_stack.add (ccode);
 		emit_context.ccode = func;
-		ccode.current_line = current_line;
+		update_ccode_line ();
 	}
 
 	public void pop_function () {
 		emit_context.ccode = emit_context.ccode_stack[emit_context.ccode_stack.size - 1];
 		emit_context.ccode_stack.remove_at (emit_context.ccode_stack.size - 1);
 		if (ccode != null) {
-			ccode.current_line = current_line;
+			update_ccode_line ();
+		}
+	}
+
+	void update_ccode_line () {
+		if (current_line != null) {
+			// share the file name of the source file instead of copying it
+			ccode.current_line_filename = current_line.file.filename;
+			ccode.current_line_number = current_line.begin.line;
+		} else {
+			ccode.current_line_filename = null;
+			ccode.current_line_number = 0;
 		}
 	}
 
@@ -706,6 +930,8 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 
 	public override void visit_source_file (SourceFile source_file) {
 		cfile = new CCodeFile ();
+		// line directives refer to the final C line numbers, keep nodes until store
+		cfile.stream_definitions = !context.debug;
 		
 		user_marshal_set = new HashSet<string> (str_hash, str_equal);
 		
@@ -1882,6 +2108,9 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 			int block_id = get_block_id (b);
 			string struct_name = "Block%dData".printf (block_id);
 
+			// closures that cannot outlive the block share its stack frame
+			bool stack_allocated = is_stack_allocated_block (b);
+
 			var data = new CCodeStruct ("_" + struct_name);
 			data.add_field ("int", "_ref_count_");
 			if (parent_block != null) {
@@ -1930,26 +2159,37 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 				}
 			}
 
-			var data_alloc = new CCodeFunctionCall (new CCodeIdentifier ("g_slice_new0"));
-			data_alloc.add_argument (new CCodeIdentifier (struct_name));
-
-			if (is_in_coroutine ()) {
-				closure_struct.add_field (struct_name + "*", "_data%d_".printf (block_id));
+			if (stack_allocated) {
+				var data_init = new CCodeInitializerList ();
+				data_init.append (new CCodeConstant ("0"));
+				ccode.add_declaration (struct_name, new CCodeVariableDeclarator ("_block%d_data_".printf (block_id), data_init));
+				ccode.add_declaration (struct_name + "*", new CCodeVariableDeclarator ("_data%d_".printf (block_id), new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, new CCodeIdentifier ("_block%d_data_".printf (block_id)))));
 			} else {
-				ccode.add_declaration (struct_name + "*", new CCodeVariableDeclarator ("_data%d_".printf (block_id)));
-			}
-			ccode.add_assignment (get_variable_cexpression ("_data%d_".printf (block_id)), data_alloc);
+				var data_alloc = new CCodeFunctionCall (new CCodeIdentifier ("g_slice_new0"));
+				data_alloc.add_argument (new CCodeIdentifier (struct_name));
 
-			// initialize ref_count
-			ccode.add_assignment (new CCodeMemberAccess.pointer (get_variable_cexpression ("_data%d_".printf (block_id)), "_ref_count_"), new CCodeIdentifier ("1"));
+				if (is_in_coroutine ()) {
+					closure_struct.add_field (struct_name + "*", "_data%d_".printf (block_id));
+				} else {
+					ccode.add_declaration (struct_name + "*", new CCodeVariableDeclarator ("_data%d_".printf (block_id)));
+				}
+				ccode.add_assignment (get_variable_cexpression ("_data%d_".printf (block_id)), data_alloc);
+
+				// initialize ref_count
+				ccode.add_assignment (new CCodeMemberAccess.pointer (get_variable_cexpression ("_data%d_".printf (block_id)), "_ref_count_"), new CCodeIdentifier ("1"));
+			}
 
 			if (parent_block != null) {
 				int parent_block_id = get_block_id (parent_block);
 
-				var ref_call = new CCodeFunctionCall (new CCodeIdentifier ("block%d_data_ref".printf (parent_block_id)));
-				ref_call.add_argument (get_variable_cexpression ("_data%d_".printf (parent_block_id)));
+				CCodeExpression parent_data = get_variable_cexpression ("_data%d_".printf (parent_block_id));
+				if (!is_stack_allocated_block (parent_block)) {
+					var ref_call = new CCodeFunctionCall (new CCodeIdentifier ("block%d_data_ref".printf (parent_block_id)));
+					ref_call.add_argument (parent_data);
+					parent_data = ref_call;
+				}
 
-				ccode.add_assignment (new CCodeMemberAccess.pointer (get_variable_cexpression ("_data%d_".printf (block_id)), "_data%d_".printf (parent_block_id)), ref_call);
+				ccode.add_assignment (new CCodeMemberAccess.pointer (get_variable_cexpression ("_data%d_".printf (block_id)), "_data%d_".printf (parent_block_id)), parent_data);
 			} else {
 				// skip self assignment in toplevel block of creation methods with chainup as self is not set at the beginning of the method
 				// the chainup statement takes care of assigning self in the closure struct
@@ -2013,21 +2253,24 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 			cfile.add_type_definition (data);
 
 			// create ref/unref functions
-			var ref_fun = new CCodeFunction ("block%d_data_ref".printf (block_id), struct_name + "*");
-			ref_fun.add_parameter (new CCodeParameter ("_data%d_".printf (block_id), struct_name + "*"));
-			ref_fun.modifiers = CCodeModifiers.STATIC;
+			// stack allocated data is never referenced and only released at the end of the block
+			if (!stack_allocated) {
+				var ref_fun = new CCodeFunction ("block%d_data_ref".printf (block_id), struct_name + "*");
+				ref_fun.add_parameter (new CCodeParameter ("_data%d_".printf (block_id), struct_name + "*"));
+				ref_fun.modifiers = CCodeModifiers.STATIC;
 
-			push_function (ref_fun);
+				push_function (ref_fun);
 
-			var ccall = new CCodeFunctionCall (new CCodeIdentifier ("g_atomic_int_inc"));
-			ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, new CCodeMemberAccess.pointer (new CCodeIdentifier ("_data%d_".printf (block_id)), "_ref_count_")));
-			ccode.add_expression (ccall);
-			ccode.add_return (new CCodeIdentifier ("_data%d_".printf (block_id)));
+				var ccall = new CCodeFunctionCall (new CCodeIdentifier ("g_atomic_int_inc"));
+				ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, new CCodeMemberAccess.pointer (new CCodeIdentifier ("_data%d_".printf (block_id)), "_ref_count_")));
+				ccode.add_expression (ccall);
+				ccode.add_return (new CCodeIdentifier ("_data%d_".printf (block_id)));
 
-			pop_function ();
+				pop_function ();
 
-			cfile.add_function_declaration (ref_fun);
-			cfile.add_function (ref_fun);
+				cfile.add_function_declaration (ref_fun);
+				cfile.add_function (ref_fun);
+			}
 
 			var unref_fun = new CCodeFunction ("block%d_data_unref".printf (block_id), "void");
 			unref_fun.add_parameter (new CCodeParameter ("_userdata_", "void *"));
@@ -2036,9 +2279,11 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 			push_function (unref_fun);
 
 			ccode.add_declaration (struct_name + "*", new CCodeVariableDeclarator ("_data%d_".printf (block_id), new CCodeCastExpression (new CCodeIdentifier ("_userdata_"), struct_name + "*")));
-			ccall = new CCodeFunctionCall (new CCodeIdentifier ("g_atomic_int_dec_and_test"));
-			ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, new CCodeMemberAccess.pointer (new CCodeIdentifier ("_data%d_".printf (block_id)), "_ref_count_")));
-			ccode.open_if (ccall);
+			if (!stack_allocated) {
+				var ccall = new CCodeFunctionCall (new CCodeIdentifier ("g_atomic_int_dec_and_test"));
+				ccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, new CCodeMemberAccess.pointer (new CCodeIdentifier ("_data%d_".printf (block_id)), "_ref_count_")));
+				ccode.open_if (ccall);
+			}
 
 			CCodeExpression outer_block = new CCodeIdentifier ("_data%d_".printf (block_id));
 			unowned Block parent_closure_block = b;
@@ -2142,9 +2387,11 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 			if (parent_block != null) {
 				int parent_block_id = get_block_id (parent_block);
 
-				var unref_call = new CCodeFunctionCall (new CCodeIdentifier ("block%d_data_unref".printf (parent_block_id)));
-				unref_call.add_argument (new CCodeMemberAccess.pointer (new CCodeIdentifier ("_data%d_".printf (block_id)), "_data%d_".printf (parent_block_id)));
-				ccode.add_expression (unref_call);
+				if (!is_stack_allocated_block (parent_block)) {
+					var unref_call = new CCodeFunctionCall (new CCodeIdentifier ("block%d_data_unref".printf (parent_block_id)));
+					unref_call.add_argument (new CCodeMemberAccess.pointer (new CCodeIdentifier ("_data%d_".printf (block_id)), "_data%d_".printf (parent_block_id)));
+					ccode.add_expression (unref_call);
+				}
 				ccode.add_assignment (new CCodeMemberAccess.pointer (new CCodeIdentifier ("_data%d_".printf (block_id)), "_data%d_".printf (parent_block_id)), new CCodeConstant ("NULL"));
 			} else {
 				var this_type = get_this_type ();
@@ -2159,12 +2406,14 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 				}
 			}
 
-			var data_free = new CCodeFunctionCall (new CCodeIdentifier ("g_slice_free"));
-			data_free.add_argument (new CCodeIdentifier (struct_name));
-			data_free.add_argument (new CCodeIdentifier ("_data%d_".printf (block_id)));
-			ccode.add_expression (data_free);
+			if (!stack_allocated) {
+				var data_free = new CCodeFunctionCall (new CCodeIdentifier ("g_slice_free"));
+				data_free.add_argument (new CCodeIdentifier (struct_name));
+				data_free.add_argument (new CCodeIdentifier ("_data%d_".printf (block_id)));
+				ccode.add_expression (data_free);
 
-			ccode.close ();
+				ccode.close ();
+			}
 
 			pop_function ();
 
@@ -2390,6 +2639,11 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 						emit_temp_var (target_destroy_notify_var);
 					}
 				}
+			} else if (local.is_appendable_string ()) {
+				// create variables to track the length and allocated size of the string buffer
+				// a size of 0 means that the buffer was not allocated by _vala_string_append
+				emit_temp_var (new LocalVariable (context.analyzer.size_t_type.copy (), get_string_length_cname (get_local_cname (local))));
+				emit_temp_var (new LocalVariable (context.analyzer.size_t_type.copy (), get_string_size_cname (get_local_cname (local))));
 			}
 		}
 
@@ -2653,6 +2907,11 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 		} else if (type.type_parameter != null) {
 			string func_name = "%s_dup_func".printf (type.type_parameter.name.down ());
 
+			if (is_specialized_type_parameter (type.type_parameter)) {
+				// no dup function is stored for specialized classes
+				return new CCodeConstant ("NULL");
+			}
+
 			if (type.type_parameter.parent_symbol is Interface) {
 				var iface = (Interface) type.type_parameter.parent_symbol;
 				require_generic_accessors (iface);
@@ -3151,6 +3410,11 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 		} else if (type.type_parameter != null) {
 			string func_name = "%s_destroy_func".printf (type.type_parameter.name.down ());
 
+			if (is_specialized_type_parameter (type.type_parameter)) {
+				// no destroy function is stored for specialized classes
+				return new CCodeConstant ("NULL");
+			}
+
 			if (type.type_parameter.parent_symbol is Interface) {
 				var iface = (Interface) type.type_parameter.parent_symbol;
 				require_generic_accessors (iface);
@@ -4055,6 +4319,11 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 		return null;
 	}
 
+	public static bool is_specialized_type_parameter (TypeParameter type_param) {
+		var cl = type_param.parent_symbol as Class;
+		return cl != null && cl.is_specialized;
+	}
+
 	bool is_limited_generic_type (DataType type) {
 		var cl = type.type_parameter.parent_symbol as Class;
 		var st = type.type_parameter.parent_symbol as Struct;
@@ -4063,6 +4332,10 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 			// have very limited generics support
 			return true;
 		}
+		if (cl != null && cl.is_specialized) {
+			// type arguments of specialized classes are never copied or destroyed
+			return true;
+		}
 		return false;
 	}
 
@@ -4598,15 +4871,15 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 
 			int i = 1;
 			int arg_pos;
-			Iterator<Parameter> params_it = params.iterator ();
+			int param_index = 0;
 			foreach (Expression arg in expr.get_argument_list ()) {
 				CCodeExpression cexpr = get_cvalue (arg);
 
 				var carg_map = in_arg_map;
 
 				Parameter param = null;
-				if (params_it.next ()) {
-					param = params_it.get ();
+				if (param_index < params.size) {
+					param = params[param_index++];
 					ellipsis = param.ellipsis;
 					if (!ellipsis) {
 						if (param.direction == ParameterDirection.OUT) {
@@ -4658,8 +4931,8 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 
 				i++;
 			}
-			if (params_it.next ()) {
-				var param = params_it.get ();
+			if (param_index < params.size) {
+				var param = params[param_index];
 				
 				/* if there are more parameters than arguments,
 				 * the additional parameter is an ellipsis parameter
@@ -5823,6 +6096,19 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 			return;
 		}
 
+		if (instance != null && prop.set_accessor.automatic_body && !requires_destroy (prop.property_type) && is_direct_property_access (prop, instance)) {
+			// same as the automatic setter, without the call
+			store_field (prop.field, instance.target_value, value);
+
+			if (is_gobject_property (prop) && get_ccode_notify (prop)) {
+				var notify_call = new CCodeFunctionCall (new CCodeIdentifier ("g_object_notify"));
+				notify_call.add_argument (new CCodeCastExpression ((CCodeExpression) get_ccodenode (instance), "GObject *"));
+				notify_call.add_argument (get_property_canonical_cconstant (prop));
+				ccode.add_expression (notify_call);
+			}
+			return;
+		}
+
 		var set_func = "g_object_set";
 		
 		var base_property = prop;
@@ -6286,6 +6572,10 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 		return m.get_attribute_bool ("CCode", "simple_generics");
 	}
 
+	public static bool get_ccode_header_inline (Method m) {
+		return m.get_attribute_bool ("CCode", "header_inline");
+	}
+
 	public static string get_ccode_real_name (Symbol sym) {
 		return get_ccode_attribute(sym).real_name;
 	}
@@ -6608,6 +6898,14 @@ public abstract class Vala.CCodeBaseModule : CodeGenerator {
 		return "";
 	}
 
+	public string get_string_length_cname (string string_cname) {
+		return "_%s_length_".printf (string_cname);
+	}
+
+	public string get_string_size_cname (string string_cname) {
+		return "_%s_capacity_".printf (string_cname);
+	}
+
 	public virtual void add_simple_check (CodeNode node, bool always_fails = false) {
 	}
 
@@ -36,7 +36,7 @@ public abstract class Vala.CCodeMemberAccessModule : CCodeControlFlowModule {
 		if (expr.symbol_reference is Method) {
 			var m = (Method) expr.symbol_reference;
 
-			if (!(m is DynamicMethod || m is ArrayMoveMethod || m is ArrayResizeMethod)) {
+			if (!(m is DynamicMethod || m is ArrayMoveMethod || m is ArrayResizeMethod || m is ArrayReserveMethod || m is ArrayAppendMethod)) {
 				generate_method_declaration (m, cfile);
 
 				if (!m.external && m.external_package) {
@@ -65,7 +65,11 @@ public abstract class Vala.CCodeMemberAccessModule : CCodeControlFlowModule {
 				}
 			}
 
-			if (m.base_method != null) {
+			if (expr.parent_node is MethodCall && ((MethodCall) expr.parent_node).call == expr && is_final_method (m)) {
+				// no subclass overrides the implementation, bypass the vtable
+				generate_real_method_declaration (m, cfile);
+				set_cvalue (expr, new CCodeIdentifier (get_ccode_real_name (m)));
+			} else if (m.base_method != null) {
 				if (!method_has_wrapper (m.base_method)) {
 					var base_class = (Class) m.base_method.parent_symbol;
 					var vclass = new CCodeFunctionCall (new CCodeIdentifier ("%s_GET_CLASS".printf (get_ccode_upper_case_name (base_class))));
@@ -78,6 +82,9 @@ public abstract class Vala.CCodeMemberAccessModule : CCodeControlFlowModule {
 				set_cvalue (expr, new CCodeIdentifier (get_ccode_name (m.base_interface_method)));
 			} else if (m is CreationMethod) {
 				set_cvalue (expr, new CCodeIdentifier (get_ccode_real_name (m)));
+			} else if (expr.parent_node is MethodCall && ((MethodCall) expr.parent_node).call == expr && has_unchecked_entry_point (m)) {
+				// arguments of direct calls within this compilation are not checked again
+				set_cvalue (expr, new CCodeIdentifier (get_unchecked_cname (m)));
 			} else {
 				set_cvalue (expr, new CCodeIdentifier (get_ccode_name (m)));
 			}
@@ -194,8 +201,8 @@ public abstract class Vala.CCodeMemberAccessModule : CCodeControlFlowModule {
 			} else if (prop.binding == MemberBinding.INSTANCE &&
 			    prop.get_accessor.automatic_body &&
 			    !prop.get_accessor.value_type.value_owned &&
-			    current_type_symbol == prop.parent_symbol &&
-			    current_type_symbol is Class &&
+			    (current_type_symbol == prop.parent_symbol || is_direct_property_access (prop, expr)) &&
+			    prop.parent_symbol is Class &&
 			    prop.base_property == null &&
 			    prop.base_interface_property == null &&
 			    !(prop.property_type is ArrayType || prop.property_type is DelegateType)) {
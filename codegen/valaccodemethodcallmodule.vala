@@ -310,6 +310,10 @@ public class Vala.CCodeMethodCallModule : CCodeAssignmentModule {
 			if (!current_class.is_compact && current_class.get_type_parameters ().size > 0) {
 				/* type, dup func, and destroy func fields for generic types */
 				var suffices = new string[] {"type", "dup_func", "destroy_func"};
+				if (current_class.is_specialized) {
+					// specialized classes do not store dup and destroy functions
+					suffices = new string[] {"type"};
+				}
 				foreach (TypeParameter type_param in current_class.get_type_parameters ()) {
 					var priv_access = new CCodeMemberAccess.pointer (new CCodeIdentifier ("self"), "priv");
 
@@ -327,14 +331,14 @@ public class Vala.CCodeMethodCallModule : CCodeAssignmentModule {
 		
 		int i = 1;
 		int arg_pos;
-		Iterator<Parameter> params_it = params.iterator ();
+		int param_index = 0;
 		foreach (Expression arg in expr.get_argument_list ()) {
 			CCodeExpression cexpr = get_cvalue (arg);
 
 			var carg_map = in_arg_map;
 
-			if (params_it.next ()) {
-				var param = params_it.get ();
+			if (param_index < params.size) {
+				var param = params[param_index++];
 				ellipsis = param.params_array || param.ellipsis;
 				if (!ellipsis) {
 					if (param.direction == ParameterDirection.OUT) {
@@ -459,8 +463,8 @@ public class Vala.CCodeMethodCallModule : CCodeAssignmentModule {
 
 			i++;
 		}
-		if (params_it.next ()) {
-			var param = params_it.get ();
+		if (param_index < params.size) {
+			var param = params[param_index];
 
 			/* if there are more parameters than arguments,
 			 * the additional parameter is an ellipsis parameter
@@ -798,12 +802,12 @@ public class Vala.CCodeMethodCallModule : CCodeAssignmentModule {
 			((GLibValue) expr.target_value).lvalue = true;
 		}
 
-		params_it = params.iterator ();
+		param_index = 0;
 		foreach (Expression arg in expr.get_argument_list ()) {
 			Parameter param = null;
 			
-			if (params_it.next ()) {
-				param = params_it.get ();
+			if (param_index < params.size) {
+				param = params[param_index++];
 				if (param.params_array || param.ellipsis) {
 					// ignore ellipsis arguments as we currently don't use temporary variables for them
 					break;
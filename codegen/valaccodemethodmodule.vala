@@ -154,10 +154,22 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 		if (m.is_async_callback) {
 			return;
 		}
+		if (!decl_space.is_header && has_unchecked_entry_point (m) && !decl_space.add_declaration (get_unchecked_cname (m))) {
+			// internal function without argument checks, see visit_method
+			var unchecked_function = new CCodeFunction (get_unchecked_cname (m));
+			unchecked_function.modifiers |= CCodeModifiers.INTERNAL;
+			generate_cparameters (m, decl_space, new HashMap<int,CCodeParameter> (direct_hash, direct_equal), unchecked_function);
+			decl_space.add_function_declaration (unchecked_function);
+		}
 		if (add_symbol_declaration (decl_space, m, get_ccode_name (m))) {
 			return;
 		}
 
+		if (is_header_inline_method (m)) {
+			generate_inline_method_definition (m, decl_space);
+			return;
+		}
+
 		var function = new CCodeFunction (get_ccode_name (m));
 
 		if (m.is_private_symbol () && !m.external) {
@@ -218,6 +230,48 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 		}
 	}
 
+	void generate_inline_method_definition (Method m, CCodeFile decl_space) {
+		var function = new CCodeFunction (get_ccode_name (m));
+		function.modifiers = CCodeModifiers.STATIC | CCodeModifiers.INLINE;
+
+		generate_cparameters (m, decl_space, new HashMap<int,CCodeParameter> (direct_hash, direct_equal), function);
+
+		push_context (new EmitContext (m));
+		push_function (function);
+
+		foreach (Statement stmt in m.body.get_statements ()) {
+			var ret = stmt as ReturnStatement;
+			if (ret != null) {
+				ret.return_expression.emit (this);
+				ccode.add_return (get_cvalue (ret.return_expression));
+			} else {
+				stmt.emit (this);
+			}
+		}
+
+		pop_function ();
+		pop_context ();
+
+		// every translation unit gets its own copy, headers do not contain definitions otherwise
+		decl_space.add_type_member_declaration (function);
+	}
+
+	public void generate_real_method_declaration (Method m, CCodeFile decl_space) {
+		if (decl_space.add_declaration (get_ccode_real_name (m))) {
+			return;
+		}
+
+		// matches the *_real_* function emitted in visit_method
+		var function = new CCodeFunction (get_ccode_real_name (m));
+		if (m.base_method != null || (context.hide_internal && m.is_internal_symbol ())) {
+			function.modifiers |= CCodeModifiers.INTERNAL;
+		}
+
+		generate_cparameters (m, decl_space, new HashMap<int,CCodeParameter> (direct_hash, direct_equal), function);
+
+		decl_space.add_function_declaration (function);
+	}
+
 	void register_plugin_types (Symbol sym, Set<Symbol> registered_types) {
 		var ns = sym as Namespace;
 		var cl = sym as Class;
@@ -348,6 +402,15 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 			}
 		}
 
+		if (get_ccode_header_inline (m) && !is_header_inline_method (m)) {
+			Report.warning (m.source_reference, "method is too complex to be defined in the header, `header_inline' ignored");
+		} else if (is_header_inline_method (m)) {
+			// the body is part of the declaration
+			pop_line ();
+			pop_context ();
+			return;
+		}
+
 		if (profile) {
 			string prefix = "_vala_prof_%s".printf (real_name);
 
@@ -409,8 +472,12 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 			cfile.add_function (destructor);
 		}
 
+		// public functions check their arguments and call the unchecked body,
+		// which is also called directly from within this compilation
+		bool unchecked_entry_point = has_unchecked_entry_point (m);
+
 		CCodeFunction function;
-		function = new CCodeFunction (real_name);
+		function = new CCodeFunction (unchecked_entry_point ? get_unchecked_cname (m) : real_name);
 
 		if (m.is_inline) {
 			function.modifiers |= CCodeModifiers.INLINE;
@@ -426,11 +493,16 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 			if (!m.coroutine) {
 				if (m.base_method != null || m.base_interface_method != null) {
 					// declare *_real_* function
-					function.modifiers |= CCodeModifiers.STATIC;
+					if (is_final_method (m)) {
+						// called directly from other source files
+						function.modifiers |= CCodeModifiers.INTERNAL;
+					} else {
+						function.modifiers |= CCodeModifiers.STATIC;
+					}
 					cfile.add_function_declaration (function);
 				} else if (m.is_private_symbol ()) {
 					function.modifiers |= CCodeModifiers.STATIC;
-				} else if (context.hide_internal && m.is_internal_symbol ()) {
+				} else if (unchecked_entry_point || (context.hide_internal && m.is_internal_symbol ())) {
 					function.modifiers |= CCodeModifiers.INTERNAL;
 				}
 			} else {
@@ -541,7 +613,8 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 						ccode.add_assignment (new CCodeIdentifier ("self"), cself);
 					} else if (m.binding == MemberBinding.INSTANCE
 							   && !(m is CreationMethod)
-							   && m.base_method == null && m.base_interface_method == null) {
+							   && m.base_method == null && m.base_interface_method == null
+							   && !unchecked_entry_point) {
 						create_method_type_check_statement (m, creturn_type, cl, true, "self");
 					}
 				}
@@ -553,7 +626,7 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 
 					if (param.direction != ParameterDirection.OUT) {
 						var t = param.variable_type.data_type;
-						if (t != null && (t.is_reference_type () || param.variable_type.is_real_struct_type ())) {
+						if (t != null && (t.is_reference_type () || param.variable_type.is_real_struct_type ()) && !unchecked_entry_point) {
 							var cname = get_variable_cname (param.name);
 							if (param.direction == ParameterDirection.REF && !param.variable_type.is_real_struct_type ()) {
 								cname = "*"+cname;
@@ -623,6 +696,10 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 								assign = new CCodeAssignment (new CCodeMemberAccess.pointer (priv_access, param_name.name), param_name);
 								ccode.add_expression (assign);
 
+								if (cl.is_specialized) {
+									continue;
+								}
+
 								param_name = new CCodeIdentifier ("%s_dup_func".printf (type_param.name.down ()));
 								assign = new CCodeAssignment (new CCodeMemberAccess.pointer (priv_access, param_name.name), param_name);
 								ccode.add_expression (assign);
@@ -820,24 +897,28 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 			generate_vfunc (m, creturn_type, cparam_map, carg_map);
 		}
 
+		if (unchecked_entry_point) {
+			generate_checked_entry_point (m, creturn_type);
+		}
+
 		if (m.entry_point) {
 			// m is possible entry point, add appropriate startup code
 			var cmain = new CCodeFunction ("main", "int");
-			cmain.line = function.line;
+			cmain.copy_line (function);
 			cmain.add_parameter (new CCodeParameter ("argc", "int"));
 			cmain.add_parameter (new CCodeParameter ("argv", "char **"));
 			push_function (cmain);
 
 			if (context.mem_profiler) {
 				var mem_profiler_init_call = new CCodeFunctionCall (new CCodeIdentifier ("g_mem_set_vtable"));
-				mem_profiler_init_call.line = cmain.line;
+				mem_profiler_init_call.copy_line (cmain);
 				mem_profiler_init_call.add_argument (new CCodeConstant ("glib_mem_profiler_table"));
 				ccode.add_expression (mem_profiler_init_call);
 			}
 
 			if (context.thread) {
 				var thread_init_call = new CCodeFunctionCall (new CCodeIdentifier ("g_thread_init"));
-				thread_init_call.line = cmain.line;
+				thread_init_call.copy_line (cmain);
 				thread_init_call.add_argument (new CCodeConstant ("NULL"));
 
 				var cond = new CCodeIfSection ("!GLIB_CHECK_VERSION (2,32,0)");
@@ -1108,6 +1189,65 @@ public abstract class Vala.CCodeMethodModule : CCodeStructModule {
 		pop_context ();
 	}
 
+	void generate_checked_entry_point (Method m, DataType return_type) {
+		push_context (new EmitContext ());
+
+		var function = new CCodeFunction (get_ccode_name (m));
+		if (context.hide_internal && m.is_internal_symbol ()) {
+			function.modifiers |= CCodeModifiers.INTERNAL;
+		}
+		if (m.deprecated) {
+			function.modifiers |= CCodeModifiers.DEPRECATED;
+		}
+
+		var ccall = new CCodeFunctionCall (new CCodeIdentifier (get_unchecked_cname (m)));
+		var carg_map = new HashMap<int,CCodeExpression> (direct_hash, direct_equal);
+		if (m.binding == MemberBinding.INSTANCE) {
+			// class instances and struct pointers are both passed as self
+			carg_map.set (get_param_pos (get_ccode_instance_pos (m)), new CCodeIdentifier ("self"));
+		}
+		generate_cparameters (m, cfile, new HashMap<int,CCodeParameter> (direct_hash, direct_equal), function, null, carg_map, ccall);
+
+		push_function (function);
+
+		if (m.return_type.data_type is Struct && ((Struct) m.return_type.data_type).is_simple_type () && default_value_for_type (m.return_type, false) == null) {
+			// the type check will use the result variable
+			var vardecl = new CCodeVariableDeclarator ("result", default_value_for_type (m.return_type, true));
+			vardecl.init0 = true;
+			ccode.add_declaration (get_ccode_name (m.return_type), vardecl);
+		}
+
+		if (m.binding == MemberBinding.INSTANCE && m.parent_symbol is Class) {
+			create_method_type_check_statement (m, return_type, (Class) m.parent_symbol, true, "self");
+		}
+
+		foreach (Parameter param in m.get_parameters ()) {
+			if (param.direction == ParameterDirection.OUT) {
+				continue;
+			}
+			var t = param.variable_type.data_type;
+			if (t != null && (t.is_reference_type () || param.variable_type.is_real_struct_type ())) {
+				var cname = get_variable_cname (param.name);
+				if (param.direction == ParameterDirection.REF && !param.variable_type.is_real_struct_type ()) {
+					cname = "*"+cname;
+				}
+				create_method_type_check_statement (m, return_type, t, !param.variable_type.nullable, cname);
+			}
+		}
+
+		if (return_type is VoidType || return_type.is_real_non_null_struct_type ()) {
+			ccode.add_expression (ccall);
+		} else {
+			ccode.add_return (ccall);
+		}
+
+		pop_function ();
+
+		cfile.add_function (function);
+
+		pop_context ();
+	}
+
 	private void create_method_type_check_statement (Method m, DataType return_type, TypeSymbol t, bool non_null, string var_name) {
 		if (!m.coroutine) {
 			create_type_check_statement (m, return_type, t, non_null, var_name);
@@ -100,6 +100,10 @@ public class Vala.GAsyncModule : GtkModule {
 	CCodeFunction generate_free_function (Method m) {
 		var dataname = Symbol.lower_case_to_camel_case (get_ccode_name (m)) + "Data";
 
+		if (m.get_attribute_bool ("CCode", "pool_data") && !is_data_pooled (m)) {
+			Report.warning (m.source_reference, "pooling of async data requires GLib 2.32");
+		}
+
 		var freefunc = new CCodeFunction (get_ccode_real_name (m) + "_data_free", "void");
 		freefunc.modifiers = CCodeModifiers.STATIC;
 		freefunc.add_parameter (new CCodeParameter ("_data", "gpointer"));
@@ -137,10 +141,17 @@ public class Vala.GAsyncModule : GtkModule {
 			}
 		}
 
-		var freecall = new CCodeFunctionCall (new CCodeIdentifier ("g_slice_free"));
-		freecall.add_argument (new CCodeIdentifier (dataname));
-		freecall.add_argument (new CCodeIdentifier ("_data_"));
-		ccode.add_expression (freecall);
+		if (is_data_pooled (m)) {
+			var releasecall = new CCodeFunctionCall (new CCodeIdentifier ("_vala_data_pool_release"));
+			releasecall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, new CCodeIdentifier (generate_data_pool (m))));
+			releasecall.add_argument (new CCodeIdentifier ("_data_"));
+			ccode.add_expression (releasecall);
+		} else {
+			var freecall = new CCodeFunctionCall (new CCodeIdentifier ("g_slice_free"));
+			freecall.add_argument (new CCodeIdentifier (dataname));
+			freecall.add_argument (new CCodeIdentifier ("_data_"));
+			ccode.add_expression (freecall);
+		}
 
 		pop_context ();
 
@@ -150,6 +161,146 @@ public class Vala.GAsyncModule : GtkModule {
 		return freefunc;
 	}
 
+	bool is_data_pooled (Method m) {
+		// G_PRIVATE_INIT is not available in older GLib versions
+		return m.get_attribute_bool ("CCode", "pool_data") && context.require_glib_version (2, 32);
+	}
+
+	/**
+	 * Declares the per-thread free list recycling the async data of the
+	 * specified method and returns its name.
+	 */
+	string generate_data_pool (Method m) {
+		string pool_name = get_ccode_real_name (m) + "_data_pool";
+
+		if (!add_wrapper (pool_name)) {
+			// pool already declared
+			return pool_name;
+		}
+
+		generate_data_pool_functions ();
+
+		var pool_decl = new CCodeDeclaration ("GPrivate");
+		pool_decl.add_declarator (new CCodeVariableDeclarator (pool_name, new CCodeConstant ("G_PRIVATE_INIT (_vala_data_pool_free)")));
+		pool_decl.modifiers = CCodeModifiers.STATIC;
+		cfile.add_type_member_declaration (pool_decl);
+
+		return pool_name;
+	}
+
+	void generate_data_pool_functions () {
+		if (!add_wrapper ("_vala_data_pool_alloc")) {
+			return;
+		}
+
+		cfile.add_include ("string.h");
+
+		// released data blocks are linked through their first two pointers,
+		// holding the next block and the length of the list
+		var next = new CCodeElementAccess (new CCodeIdentifier ("list"), new CCodeConstant ("0"));
+		var length = new CCodeElementAccess (new CCodeIdentifier ("list"), new CCodeConstant ("1"));
+
+		// free list, called when the thread exits
+		var function = new CCodeFunction ("_vala_data_pool_free", "void");
+		function.modifiers = CCodeModifiers.STATIC;
+		function.add_parameter (new CCodeParameter ("data", "gpointer"));
+
+		push_function (function);
+
+		ccode.add_declaration ("gpointer*", new CCodeVariableDeclarator ("list", new CCodeIdentifier ("data")));
+		ccode.open_while (new CCodeBinaryExpression (CCodeBinaryOperator.INEQUALITY, new CCodeIdentifier ("list"), new CCodeConstant ("NULL")));
+		ccode.add_declaration ("gpointer*", new CCodeVariableDeclarator ("next", next));
+		var free_call = new CCodeFunctionCall (new CCodeIdentifier ("g_free"));
+		free_call.add_argument (new CCodeIdentifier ("list"));
+		ccode.add_expression (free_call);
+		ccode.add_assignment (new CCodeIdentifier ("list"), new CCodeIdentifier ("next"));
+		ccode.close ();
+
+		pop_function ();
+
+		cfile.add_function_declaration (function);
+		cfile.add_function (function);
+
+		// take data block from free list or allocate a new one
+		function = new CCodeFunction ("_vala_data_pool_alloc", "gpointer");
+		function.modifiers = CCodeModifiers.STATIC;
+		function.add_parameter (new CCodeParameter ("pool", "GPrivate*"));
+		function.add_parameter (new CCodeParameter ("size", "gsize"));
+
+		push_function (function);
+
+		var get_call = new CCodeFunctionCall (new CCodeIdentifier ("g_private_get"));
+		get_call.add_argument (new CCodeIdentifier ("pool"));
+		ccode.add_declaration ("gpointer*", new CCodeVariableDeclarator ("list", get_call));
+
+		ccode.open_if (new CCodeBinaryExpression (CCodeBinaryOperator.EQUALITY, new CCodeIdentifier ("list"), new CCodeConstant ("NULL")));
+		var alloc_call = new CCodeFunctionCall (new CCodeIdentifier ("g_malloc0"));
+		alloc_call.add_argument (new CCodeIdentifier ("size"));
+		ccode.add_return (alloc_call);
+		ccode.close ();
+
+		var set_call = new CCodeFunctionCall (new CCodeIdentifier ("g_private_set"));
+		set_call.add_argument (new CCodeIdentifier ("pool"));
+		set_call.add_argument (next);
+		ccode.add_expression (set_call);
+
+		var memset_call = new CCodeFunctionCall (new CCodeIdentifier ("memset"));
+		memset_call.add_argument (new CCodeIdentifier ("list"));
+		memset_call.add_argument (new CCodeConstant ("0"));
+		memset_call.add_argument (new CCodeIdentifier ("size"));
+		ccode.add_expression (memset_call);
+
+		ccode.add_return (new CCodeIdentifier ("list"));
+
+		pop_function ();
+
+		cfile.add_function_declaration (function);
+		cfile.add_function (function);
+
+		// return data block to free list of the current thread
+		function = new CCodeFunction ("_vala_data_pool_release", "void");
+		function.modifiers = CCodeModifiers.STATIC;
+		function.add_parameter (new CCodeParameter ("pool", "GPrivate*"));
+		function.add_parameter (new CCodeParameter ("data", "gpointer"));
+
+		push_function (function);
+
+		get_call = new CCodeFunctionCall (new CCodeIdentifier ("g_private_get"));
+		get_call.add_argument (new CCodeIdentifier ("pool"));
+		ccode.add_declaration ("gpointer*", new CCodeVariableDeclarator ("list", get_call));
+		ccode.add_declaration ("guint", new CCodeVariableDeclarator ("list_length", new CCodeConstant ("0")));
+
+		ccode.open_if (new CCodeBinaryExpression (CCodeBinaryOperator.INEQUALITY, new CCodeIdentifier ("list"), new CCodeConstant ("NULL")));
+		var to_uint = new CCodeFunctionCall (new CCodeIdentifier ("GPOINTER_TO_UINT"));
+		to_uint.add_argument (length);
+		ccode.add_assignment (new CCodeIdentifier ("list_length"), to_uint);
+		ccode.close ();
+
+		// limit memory kept alive per thread
+		ccode.open_if (new CCodeBinaryExpression (CCodeBinaryOperator.GREATER_THAN_OR_EQUAL, new CCodeIdentifier ("list_length"), new CCodeConstant ("16")));
+		free_call = new CCodeFunctionCall (new CCodeIdentifier ("g_free"));
+		free_call.add_argument (new CCodeIdentifier ("data"));
+		ccode.add_expression (free_call);
+		ccode.add_return ();
+		ccode.close ();
+
+		var data = new CCodeCastExpression (new CCodeIdentifier ("data"), "gpointer*");
+		ccode.add_assignment (new CCodeElementAccess (data, new CCodeConstant ("0")), new CCodeIdentifier ("list"));
+		var to_pointer = new CCodeFunctionCall (new CCodeIdentifier ("GUINT_TO_POINTER"));
+		to_pointer.add_argument (new CCodeBinaryExpression (CCodeBinaryOperator.PLUS, new CCodeIdentifier ("list_length"), new CCodeConstant ("1")));
+		ccode.add_assignment (new CCodeElementAccess (data, new CCodeConstant ("1")), to_pointer);
+
+		set_call = new CCodeFunctionCall (new CCodeIdentifier ("g_private_set"));
+		set_call.add_argument (new CCodeIdentifier ("pool"));
+		set_call.add_argument (new CCodeIdentifier ("data"));
+		ccode.add_expression (set_call);
+
+		pop_function ();
+
+		cfile.add_function_declaration (function);
+		cfile.add_function (function);
+	}
+
 	void generate_async_function (Method m) {
 		push_context (new EmitContext ());
 
@@ -193,8 +344,17 @@ public class Vala.GAsyncModule : GtkModule {
 			ccode.add_assignment (new CCodeIdentifier ("self"), cself);
 		}
 
-		var dataalloc = new CCodeFunctionCall (new CCodeIdentifier ("g_slice_new0"));
-		dataalloc.add_argument (new CCodeIdentifier (dataname));
+		CCodeExpression dataalloc;
+		if (is_data_pooled (m)) {
+			var alloccall = new CCodeFunctionCall (new CCodeIdentifier ("_vala_data_pool_alloc"));
+			alloccall.add_argument (new CCodeUnaryExpression (CCodeUnaryOperator.ADDRESS_OF, new CCodeIdentifier (generate_data_pool (m))));
+			alloccall.add_argument (new CCodeIdentifier ("sizeof (%s)".printf (dataname)));
+			dataalloc = alloccall;
+		} else {
+			var alloccall = new CCodeFunctionCall (new CCodeIdentifier ("g_slice_new0"));
+			alloccall.add_argument (new CCodeIdentifier (dataname));
+			dataalloc = alloccall;
+		}
 
 		var data_var = new CCodeIdentifier ("_data_");
 
@@ -1051,6 +1051,10 @@ public class Vala.GIRWriter : CodeVisitor {
 		if (can_fail) {
 			buffer.append_printf (" throws=\"1\"");
 		}
+		if (CCodeBaseModule.get_ccode_header_inline (m)) {
+			// static inline functions have no symbol to bind to
+			buffer.append_printf (" introspectable=\"0\"");
+		}
 		write_symbol_attributes (m);
 		buffer.append_printf (">\n");
 		indent++;
@@ -370,19 +370,23 @@ public class Vala.GObjectModule : GTypeModule {
 			func_name = "%s_dup_func".printf (type_param.name.ascii_down ());
 			enum_value = "%s_%s".printf (get_ccode_lower_case_name (cl, null), func_name).ascii_up ();
 			ccode.add_case (new CCodeIdentifier (enum_value));
-			cfield = new CCodeMemberAccess.pointer (new CCodeMemberAccess.pointer (new CCodeIdentifier ("self"), "priv"), func_name);
-			cgetcall = new CCodeFunctionCall (new CCodeIdentifier ("g_value_get_pointer"));
-			cgetcall.add_argument (new CCodeIdentifier ("value"));
-			ccode.add_assignment (cfield, cgetcall);
+			if (!cl.is_specialized) {
+				cfield = new CCodeMemberAccess.pointer (new CCodeMemberAccess.pointer (new CCodeIdentifier ("self"), "priv"), func_name);
+				cgetcall = new CCodeFunctionCall (new CCodeIdentifier ("g_value_get_pointer"));
+				cgetcall.add_argument (new CCodeIdentifier ("value"));
+				ccode.add_assignment (cfield, cgetcall);
+			}
 			ccode.add_break ();
 
 			func_name = "%s_destroy_func".printf (type_param.name.ascii_down ());
 			enum_value = "%s_%s".printf (get_ccode_lower_case_name (cl, null), func_name).ascii_up ();
 			ccode.add_case (new CCodeIdentifier (enum_value));
-			cfield = new CCodeMemberAccess.pointer (new CCodeMemberAccess.pointer (new CCodeIdentifier ("self"), "priv"), func_name);
-			cgetcall = new CCodeFunctionCall (new CCodeIdentifier ("g_value_get_pointer"));
-			cgetcall.add_argument (new CCodeIdentifier ("value"));
-			ccode.add_assignment (cfield, cgetcall);
+			if (!cl.is_specialized) {
+				cfield = new CCodeMemberAccess.pointer (new CCodeMemberAccess.pointer (new CCodeIdentifier ("self"), "priv"), func_name);
+				cgetcall = new CCodeFunctionCall (new CCodeIdentifier ("g_value_get_pointer"));
+				cgetcall.add_argument (new CCodeIdentifier ("value"));
+				ccode.add_assignment (cfield, cgetcall);
+			}
 			ccode.add_break ();
 		}
 		ccode.add_default ();
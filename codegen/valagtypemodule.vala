@@ -420,6 +420,11 @@ public class Vala.GTypeModule : GErrorModule {
 				func_name = "%s_type".printf (type_param.name.down ());
 				instance_priv_struct.add_field ("GType", func_name);
 
+				if (cl.is_specialized) {
+					// elements are never copied or destroyed
+					continue;
+				}
+
 				func_name = "%s_dup_func".printf (type_param.name.down ());
 				instance_priv_struct.add_field ("GBoxedCopyFunc", func_name);
 
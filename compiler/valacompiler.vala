@@ -197,6 +197,10 @@ class Vala.Compiler {
 		context.checking = enable_checking;
 		context.deprecated = deprecated;
 		context.hide_internal = hide_internal;
+		// subclasses can only be declared elsewhere if an interface is emitted
+		context.whole_program = library == null && vapi_filename == null && internal_vapi_filename == null
+		                        && gir == null && header_filename == null && internal_header_filename == null
+		                        && fast_vapi_filename == null && fast_vapis == null;
 		context.experimental = experimental;
 		context.experimental_non_null = experimental_non_null;
 		context.gobject_tracing = gobject_tracing;
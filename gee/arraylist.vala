@@ -36,7 +36,7 @@ public class Vala.ArrayList<G> : List<G> {
 		set { _equal_func = value; }
 	}
 
-	private G[] _items = new G[4];
+	private G[] _items;
 	private int _size;
 	private EqualFunc _equal_func;
 
@@ -141,8 +141,13 @@ public class Vala.ArrayList<G> : List<G> {
 
 		int minimum_size = _size + new_count;
 		if (minimum_size > _items.length) {
-			// double the capacity unless we add even more items at this time
-			set_capacity (new_count > _items.length ? minimum_size : 2 * _items.length);
+			if (_items.length == 0) {
+				// allocate storage on first use, most lists stay empty
+				set_capacity (int.max (minimum_size, 4));
+			} else {
+				// double the capacity unless we add even more items at this time
+				set_capacity (new_count > _items.length ? minimum_size : 2 * _items.length);
+			}
 		}
 	}
 
@@ -0,0 +1,205 @@
+/* smalllist.vala
+ *
+ * Copyright (C) 2026  The Vala developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ */
+
+using GLib;
+
+/**
+ * Lists optimized for a small number of elements.
+ *
+ * The first elements are stored inline in the list object, storage for
+ * further elements is only allocated when the inline capacity is exceeded.
+ */
+public class Vala.SmallList<G> : List<G> {
+	public override int size {
+		get { return _size; }
+	}
+
+	public EqualFunc equal_func {
+		set { _equal_func = value; }
+	}
+
+	private const int INLINE_CAPACITY = 3;
+
+	private G _item0;
+	private G _item1;
+	private G _item2;
+	// elements beyond the inline capacity, allocated on demand
+	private G[] _items;
+	private int _size;
+	private EqualFunc _equal_func;
+
+	// concurrent modification protection
+	private int _stamp = 0;
+
+	public SmallList (EqualFunc equal_func = GLib.direct_equal) {
+		this.equal_func = equal_func;
+	}
+
+	public override Type get_element_type () {
+		return typeof (G);
+	}
+
+	public override Vala.Iterator<G> iterator () {
+		return new Iterator<G> (this);
+	}
+
+	public override bool contains (G item) {
+		return (index_of (item) != -1);
+	}
+
+	public override int index_of (G item) {
+		for (int index = 0; index < _size; index++) {
+			if (_equal_func (get_item (index), item)) {
+				return index;
+			}
+		}
+		return -1;
+	}
+
+	public override G? get (int index) {
+		assert (index >= 0 && index < _size);
+
+		return get_item (index);
+	}
+
+	public override void set (int index, G item) {
+		assert (index >= 0 && index < _size);
+
+		set_item (index, item);
+	}
+
+	public override bool add (G item) {
+		set_item (_size, item);
+		_size++;
+		_stamp++;
+		return true;
+	}
+
+	public override void insert (int index, G item) {
+		assert (index >= 0 && index <= _size);
+
+		for (int i = _size; i > index; i--) {
+			set_item (i, get_item (i - 1));
+		}
+		set_item (index, item);
+		_size++;
+		_stamp++;
+	}
+
+	public override bool remove (G item) {
+		for (int index = 0; index < _size; index++) {
+			if (_equal_func (get_item (index), item)) {
+				remove_at (index);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	public override void remove_at (int index) {
+		assert (index >= 0 && index < _size);
+
+		for (int i = index; i < _size - 1; i++) {
+			set_item (i, get_item (i + 1));
+		}
+		set_item (_size - 1, null);
+		_size--;
+		_stamp++;
+	}
+
+	public override void clear () {
+		for (int index = 0; index < _size; index++) {
+			set_item (index, null);
+		}
+		_size = 0;
+		_stamp++;
+	}
+
+	private G? get_item (int index) {
+		switch (index) {
+		case 0:
+			return _item0;
+		case 1:
+			return _item1;
+		case 2:
+			return _item2;
+		default:
+			return _items[index - INLINE_CAPACITY];
+		}
+	}
+
+	private void set_item (int index, G? item) {
+		switch (index) {
+		case 0:
+			_item0 = item;
+			break;
+		case 1:
+			_item1 = item;
+			break;
+		case 2:
+			_item2 = item;
+			break;
+		default:
+			int overflow_index = index - INLINE_CAPACITY;
+			if (overflow_index >= _items.length) {
+				// double the capacity, starting with the inline capacity
+				_items.resize (_items.length > 0 ? 2 * _items.length : INLINE_CAPACITY);
+			}
+			_items[overflow_index] = item;
+			break;
+		}
+	}
+
+	private class Iterator<G> : Vala.Iterator<G> {
+		public SmallList<G> list {
+			set {
+				_list = value;
+				_stamp = _list._stamp;
+			}
+		}
+
+		private SmallList<G> _list;
+		private int _index = -1;
+
+		// concurrent modification protection
+		public int _stamp = 0;
+
+		public Iterator (SmallList list) {
+			this.list = list;
+		}
+
+		public override bool next () {
+			assert (_stamp == _list._stamp);
+			if (_index < _list._size) {
+				_index++;
+			}
+			return (_index < _list._size);
+		}
+
+		public override G? get () {
+			assert (_stamp == _list._stamp);
+
+			if (_index < 0 || _index >= _list._size) {
+				return null;
+			}
+
+			return _list.get (_index);
+		}
+	}
+}
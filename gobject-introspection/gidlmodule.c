@@ -41,6 +41,8 @@ g_idl_module_new (const gchar *name, const gchar *shared_library)
   else
       module->shared_library = NULL;
   module->entries = NULL;
+  module->entry_index = NULL;
+  module->n_indexed_entries = 0;
 
   return module;
 }
@@ -57,9 +59,53 @@ g_idl_module_free (GIdlModule *module)
 
   g_list_free (module->entries);
 
+  if (module->entry_index)
+    g_hash_table_destroy (module->entry_index);
+
   g_free (module);
 }
 
+static gint
+compare_index_entries (gconstpointer a,
+		       gconstpointer b,
+		       gpointer      user_data)
+{
+  GIdlNode **nodes = user_data;
+  guint16 idx_a = *(const guint16 *)a;
+  guint16 idx_b = *(const guint16 *)b;
+  gint cmp;
+
+  cmp = strcmp (nodes[idx_a - 1]->name, nodes[idx_b - 1]->name);
+  if (cmp != 0)
+    return cmp;
+
+  return idx_a - idx_b;
+}
+
+/* writes the indices of the local entries sorted by name */
+static void
+write_directory_index (GIdlModule *module,
+		       guint32     n_local_entries,
+		       guint16    *index)
+{
+  GIdlNode **nodes;
+  GList *e;
+  gint i;
+
+  nodes = g_new (GIdlNode *, n_local_entries);
+
+  for (e = module->entries, i = 0; i < n_local_entries; e = e->next, i++)
+    {
+      nodes[i] = e->data;
+      index[i] = i + 1;
+    }
+
+  g_qsort_with_data (index, n_local_entries, sizeof (guint16),
+		     compare_index_entries, nodes);
+
+  g_free (nodes);
+}
+
 GMetadata *
 g_idl_module_build_metadata (GIdlModule  *module,
 			     GList       *modules)
@@ -72,6 +118,7 @@ g_idl_module_build_metadata (GIdlModule  *module,
   DirEntry *entry;
   guint32 header_size;
   guint32 dir_size;
+  guint32 index_size;
   guint32 n_entries;
   guint32 n_local_entries;
   guint32 size, offset, offset2, old_offset;
@@ -82,6 +129,12 @@ g_idl_module_build_metadata (GIdlModule  *module,
   header_size = ALIGN_VALUE (sizeof (Header), 4);
   n_local_entries = g_list_length (module->entries);
 
+  /* add all implicit cross references up front, appended entries
+   * are visited by the loop as well but have nothing to collect
+   */
+  for (e = module->entries; e; e = e->next)
+    g_idl_node_collect_xrefs ((GIdlNode *)e->data, module);
+
  restart:
   init_stats ();
   strings = g_hash_table_new (g_str_hash, g_str_equal);
@@ -91,10 +144,14 @@ g_idl_module_build_metadata (GIdlModule  *module,
   g_message ("%d entries (%d local)\n", n_entries, n_local_entries);
   
   dir_size = n_entries * 12;  
-  size = header_size + dir_size;
+  index_size = ALIGN_VALUE (n_local_entries * 2, 4);
+  size = header_size + dir_size + index_size;
 
   size += ALIGN_VALUE (strlen (module->name) + 1, 4);
 
+  /* computes and caches the sizes of all nodes bottom-up, the
+   * layout below only looks them up
+   */
   for (e = module->entries; e; e = e->next)
     {
       GIdlNode *node = e->data;
@@ -145,7 +202,12 @@ g_idl_module_build_metadata (GIdlModule  *module,
   /* fill in directory and content */
   entry = (DirEntry *)&data[header->directory];
 
-  offset2 = header->directory + dir_size;
+  /* the name index follows the directory */
+  header->directory_index = header->directory + dir_size;
+  write_directory_index (module, n_local_entries,
+			 (guint16 *)&data[header->directory_index]);
+
+  offset2 = header->directory_index + index_size;
 
   for (e = module->entries, i = 0; e; e = e->next, i++)
     {
@@ -156,10 +218,12 @@ g_idl_module_build_metadata (GIdlModule  *module,
 	  g_error ("Names may not contain '.'");
 	}
 
-      /* we picked up implicit xref nodes, start over */
+      /* we picked up implicit xref nodes the pre-pass missed,
+       * start over
+       */
       if (i == n_entries)
 	{
-	  g_message ("Found implicit cross references, starting over");
+	  g_warning ("Found unexpected implicit cross references, starting over");
 
 	  g_hash_table_destroy (strings);
 	  g_hash_table_destroy (types);
@@ -204,6 +268,13 @@ g_idl_module_build_metadata (GIdlModule  *module,
   g_hash_table_destroy (strings);
   g_hash_table_destroy (types);
 
+  /* entries may change after building, drop the index */
+  if (module->entry_index)
+    {
+      g_hash_table_destroy (module->entry_index);
+      module->entry_index = NULL;
+    }
+
   header->annotations = offset2;
   
   g_message ("reallocating to %d bytes", offset2);
@@ -34,6 +34,10 @@ struct _GIdlModule
   gchar *name;
   gchar *shared_library;
   GList *entries;
+
+  /* name -> entry, only valid while building metadata */
+  GHashTable *entry_index;
+  guint16 n_indexed_entries;
 };
 
 GIdlModule *g_idl_module_new            (const gchar *name,
@@ -484,15 +484,12 @@ g_idl_node_get_size (GIdlNode *node)
   return size;
 }
 
-/* returns the full size of the blob including variable-size parts */
-guint32
-g_idl_node_get_full_size (GIdlNode *node)
+static guint32
+compute_full_size (GIdlNode *node)
 {
   GList *l;
   gint size, n;
 
-  g_assert (node != NULL);
-
   switch (node->type)
     {
     case G_IDL_NODE_CALLBACK:
@@ -764,6 +761,20 @@ g_idl_node_get_full_size (GIdlNode *node)
   return size;
 }
 
+/* returns the full size of the blob including variable-size parts,
+ * the size of child nodes is computed once and cached on the nodes
+ */
+guint32
+g_idl_node_get_full_size (GIdlNode *node)
+{
+  g_assert (node != NULL);
+
+  if (node->full_size == 0)
+    node->full_size = compute_full_size (node);
+
+  return node->full_size;
+}
+
 int
 g_idl_node_cmp (GIdlNode *node,
 		GIdlNode *other)
@@ -797,6 +808,9 @@ g_idl_node_add_member (GIdlNode         *node,
 {
   g_return_if_fail (node != NULL);
   g_return_if_fail (member != NULL);
+
+  /* the size of the container depends on its members */
+  node->full_size = 0;
 		    
   switch (node->type)
     {
@@ -870,6 +884,58 @@ parse_boolean_value (const gchar *str)
   return parse_int_value (str) ? TRUE : FALSE;
 }
 
+typedef struct
+{
+  GIdlNode *node;
+  guint16   idx;
+} EntryRef;
+
+static void
+index_entry (GIdlModule *module,
+	     GIdlNode   *node)
+{
+  EntryRef *ref;
+  gchar *key;
+
+  ref = g_new (EntryRef, 1);
+  ref->node = node;
+  ref->idx = ++module->n_indexed_entries;
+
+  /* unqualified lookups match the first entry with that name,
+   * qualified lookups only match cross references
+   */
+  if (node->type == G_IDL_NODE_XREF &&
+      ((GIdlNodeXRef *)node)->namespace != NULL)
+    {
+      key = g_strconcat (((GIdlNodeXRef *)node)->namespace, ".", node->name, NULL);
+      if (!g_hash_table_lookup (module->entry_index, key))
+	g_hash_table_insert (module->entry_index, key, g_memdup (ref, sizeof (EntryRef)));
+      else
+	g_free (key);
+    }
+
+  if (!g_hash_table_lookup (module->entry_index, node->name))
+    g_hash_table_insert (module->entry_index, g_strdup (node->name), ref);
+  else
+    g_free (ref);
+}
+
+static void
+ensure_entry_index (GIdlModule *module)
+{
+  GList *l;
+
+  if (module->entry_index)
+    return;
+
+  module->entry_index = g_hash_table_new_full (g_str_hash, g_str_equal,
+					       g_free, g_free);
+  module->n_indexed_entries = 0;
+
+  for (l = module->entries; l; l = l->next)
+    index_entry (module, (GIdlNode *)l->data);
+}
+
 static GIdlNode *
 find_entry_node (GIdlModule  *module,
 		 GList       *modules,
@@ -877,65 +943,43 @@ find_entry_node (GIdlModule  *module,
 		 guint16     *idx)
 
 {
-  GList *l;
-  gint i;
-  gchar **names;
-  gint n_names;
-  GIdlNode *result = NULL;
+  EntryRef *ref;
+  const gchar *dot;
+
+  ensure_entry_index (module);
 
-  names = g_strsplit (name, ".", 0);
-  n_names = g_strv_length (names);
-  if (n_names > 2)
+  dot = strchr (name, '.');
+  if (dot && strchr (dot + 1, '.'))
     g_error ("Too many name parts");
-  
-  for (l = module->entries, i = 1; l; l = l->next, i++)
+
+  ref = g_hash_table_lookup (module->entry_index, name);
+  if (ref)
     {
-      GIdlNode *node = (GIdlNode *)l->data;
-      
-      if (n_names > 1)
-	{
-	  if (node->type != G_IDL_NODE_XREF)
-	    continue;
-	  
-	  if (((GIdlNodeXRef *)node)->namespace == NULL ||
-	      strcmp (((GIdlNodeXRef *)node)->namespace, names[0]) != 0)
-	    continue;
-	}
-	 
-      if (strcmp (node->name, names[n_names - 1]) == 0)
-	{
-	  if (idx)
-	    *idx = i;
-	  
-	  result = node;
-	  goto out;
-	}
+      if (idx)
+	*idx = ref->idx;
+
+      return ref->node;
     }
 
-  if (n_names > 1)
+  if (dot)
     {
       GIdlNode *node = g_idl_node_new (G_IDL_NODE_XREF);
 
-      ((GIdlNodeXRef *)node)->namespace = g_strdup (names[0]);
-      node->name = g_strdup (names[1]);
+      ((GIdlNodeXRef *)node)->namespace = g_strndup (name, dot - name);
+      node->name = g_strdup (dot + 1);
   
       module->entries = g_list_append (module->entries, node);
+      index_entry (module, node);
   
       if (idx)
-	*idx = g_list_length (module->entries);
-
-      result = node;
+	*idx = module->n_indexed_entries;
 
-      goto out;
+      return node;
     }
 
   g_warning ("Entry %s not found", name);
 
- out:
-
-  g_strfreev (names);
-
-  return result;
+  return NULL;
 }
 
 static guint16
@@ -950,6 +994,141 @@ find_entry (GIdlModule  *module,
   return idx;
 }
 
+static void
+collect_xref (GIdlModule  *module,
+	      const gchar *name)
+{
+  /* only qualified names can introduce cross references */
+  if (name && strchr (name, '.'))
+    find_entry_node (module, NULL, name, NULL);
+}
+
+static void
+collect_xrefs_list (GList      *list,
+		    GIdlModule *module)
+{
+  GList *l;
+
+  for (l = list; l; l = l->next)
+    g_idl_node_collect_xrefs ((GIdlNode *)l->data, module);
+}
+
+/* Adds the cross reference entries that building the metadata for
+ * @node would otherwise discover on the fly, so the size of the
+ * directory is known before layout starts.
+ */
+void
+g_idl_node_collect_xrefs (GIdlNode   *node,
+			  GIdlModule *module)
+{
+  GList *l;
+  gint i;
+
+  if (node == NULL)
+    return;
+
+  switch (node->type)
+    {
+    case G_IDL_NODE_FUNCTION:
+    case G_IDL_NODE_CALLBACK:
+      {
+	GIdlNodeFunction *function = (GIdlNodeFunction *)node;
+
+	g_idl_node_collect_xrefs ((GIdlNode *)function->result, module);
+	collect_xrefs_list (function->parameters, module);
+      }
+      break;
+
+    case G_IDL_NODE_TYPE:
+      {
+	GIdlNodeType *type = (GIdlNodeType *)node;
+
+	g_idl_node_collect_xrefs ((GIdlNode *)type->parameter_type1, module);
+	g_idl_node_collect_xrefs ((GIdlNode *)type->parameter_type2, module);
+
+	if (type->tag == TYPE_TAG_INTERFACE)
+	  collect_xref (module, type->interface);
+	else if (type->tag == TYPE_TAG_ERROR && type->errors)
+	  for (i = 0; type->errors[i]; i++)
+	    collect_xref (module, type->errors[i]);
+      }
+      break;
+
+    case G_IDL_NODE_PARAM:
+      g_idl_node_collect_xrefs ((GIdlNode *)((GIdlNodeParam *)node)->type, module);
+      break;
+
+    case G_IDL_NODE_PROPERTY:
+      g_idl_node_collect_xrefs ((GIdlNode *)((GIdlNodeProperty *)node)->type, module);
+      break;
+
+    case G_IDL_NODE_FIELD:
+      g_idl_node_collect_xrefs ((GIdlNode *)((GIdlNodeField *)node)->type, module);
+      break;
+
+    case G_IDL_NODE_CONSTANT:
+      g_idl_node_collect_xrefs ((GIdlNode *)((GIdlNodeConstant *)node)->type, module);
+      break;
+
+    case G_IDL_NODE_SIGNAL:
+      {
+	GIdlNodeSignal *signal = (GIdlNodeSignal *)node;
+
+	g_idl_node_collect_xrefs ((GIdlNode *)signal->result, module);
+	collect_xrefs_list (signal->parameters, module);
+      }
+      break;
+
+    case G_IDL_NODE_VFUNC:
+      {
+	GIdlNodeVFunc *vfunc = (GIdlNodeVFunc *)node;
+
+	g_idl_node_collect_xrefs ((GIdlNode *)vfunc->result, module);
+	collect_xrefs_list (vfunc->parameters, module);
+      }
+      break;
+
+    case G_IDL_NODE_OBJECT:
+    case G_IDL_NODE_INTERFACE:
+      {
+	GIdlNodeInterface *iface = (GIdlNodeInterface *)node;
+
+	collect_xref (module, iface->parent);
+	for (l = iface->interfaces; l; l = l->next)
+	  collect_xref (module, (gchar *)l->data);
+	for (l = iface->prerequisites; l; l = l->next)
+	  collect_xref (module, (gchar *)l->data);
+	collect_xrefs_list (iface->members, module);
+      }
+      break;
+
+    case G_IDL_NODE_BOXED:
+      collect_xrefs_list (((GIdlNodeBoxed *)node)->members, module);
+      break;
+
+    case G_IDL_NODE_STRUCT:
+      collect_xrefs_list (((GIdlNodeStruct *)node)->members, module);
+      break;
+
+    case G_IDL_NODE_UNION:
+      {
+	GIdlNodeUnion *union_ = (GIdlNodeUnion *)node;
+
+	g_idl_node_collect_xrefs ((GIdlNode *)union_->discriminator_type, module);
+	collect_xrefs_list (union_->members, module);
+	collect_xrefs_list (union_->discriminators, module);
+      }
+      break;
+
+    case G_IDL_NODE_ERROR_DOMAIN:
+      collect_xref (module, ((GIdlNodeErrorDomain *)node)->codes);
+      break;
+
+    default:
+      break;
+    }
+}
+
 static void
 serialize_type (GIdlModule   *module, 
 		GList        *modules,
@@ -71,6 +71,9 @@ struct _GIdlNode
 {
   GIdlNodeTypeId type;
   gchar *name;
+
+  /* cached result of g_idl_node_get_full_size, 0 if not computed yet */
+  guint32 full_size;
 };
 
 struct _GIdlNodeXRef
@@ -317,6 +320,8 @@ void      g_idl_node_build_metadata  (GIdlNode    *node,
 				      guchar      *data,
 				      guint32     *offset,
                                       guint32     *offset2);
+void      g_idl_node_collect_xrefs   (GIdlNode    *node,
+				      GIdlModule  *module);
 int       g_idl_node_cmp             (GIdlNode    *node,
 				      GIdlNode    *other);
 gboolean  g_idl_node_can_have_member (GIdlNode    *node);
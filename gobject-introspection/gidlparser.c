@@ -57,6 +57,9 @@ struct _ParseContext
 
   GIdlModule *current_module;
   GIdlNode *current_node;
+
+  /* last link of current_module->entries */
+  GList *last_entry;
 };
 
 #define MISSING_ATTRIBUTE(error,element,attribute)                            \
@@ -66,6 +69,20 @@ struct _ParseContext
 	       "The attribute '%s' on the element '%s' must be specified",    \
 	       attribute, element)
 
+static void
+add_entry (ParseContext *ctx,
+	   GIdlNode     *node)
+{
+  /* append in constant time, modules can have thousands of entries */
+  if (ctx->last_entry == NULL)
+    {
+      ctx->current_module->entries = g_list_append (ctx->current_module->entries, node);
+      ctx->last_entry = g_list_last (ctx->current_module->entries);
+    }
+  else
+    ctx->last_entry = g_list_append (ctx->last_entry, node)->next;
+}
+
 static const gchar *
 find_attribute (const gchar  *name, 
 		const gchar **attribute_names,
@@ -405,8 +422,7 @@ start_boxed (GMarkupParseContext *context,
 	    boxed->deprecated = FALSE;
 	  
 	  ctx->current_node = (GIdlNode *)boxed;
-	  ctx->current_module->entries = 
-	    g_list_append (ctx->current_module->entries, boxed);
+	  add_entry (ctx, (GIdlNode *)boxed);
 	  
 	  ctx->state = STATE_BOXED;
 	}
@@ -493,8 +509,7 @@ start_function (GMarkupParseContext *context,
 	  
 	  if (ctx->current_node == NULL)
 	    {
-	      ctx->current_module->entries = 
-		g_list_append (ctx->current_module->entries, function);	      
+	      add_entry (ctx, (GIdlNode *)function);
 	    }
 	  else
 	    switch (ctx->current_node->type)
@@ -835,8 +850,7 @@ start_enum (GMarkupParseContext *context,
 	    enum_->deprecated = FALSE;
 
 	  ctx->current_node = (GIdlNode *) enum_;
-	  ctx->current_module->entries = 
-	    g_list_append (ctx->current_module->entries, enum_);	      
+	  add_entry (ctx, (GIdlNode *)enum_);
 	  
 	  ctx->state = STATE_ENUM;
 	}
@@ -1030,8 +1044,7 @@ start_constant (GMarkupParseContext *context,
 	  if (ctx->state == STATE_NAMESPACE)
 	    {
 	      ctx->current_node = (GIdlNode *) constant;
-	      ctx->current_module->entries = 
-		g_list_append (ctx->current_module->entries, constant);
+	      add_entry (ctx, (GIdlNode *)constant);
 	    }
 	  else
 	    {
@@ -1090,8 +1103,7 @@ start_errordomain (GMarkupParseContext *context,
 	    domain->deprecated = FALSE;
 
 	  ctx->current_node = (GIdlNode *) domain;
-	  ctx->current_module->entries = 
-	    g_list_append (ctx->current_module->entries, domain);
+	  add_entry (ctx, (GIdlNode *)domain);
 
 	  ctx->state = STATE_ERRORDOMAIN;
 	}
@@ -1142,8 +1154,7 @@ start_interface (GMarkupParseContext *context,
 	    iface->deprecated = FALSE;
 	  
 	  ctx->current_node = (GIdlNode *) iface;
-	  ctx->current_module->entries = 
-	    g_list_append (ctx->current_module->entries, iface);	      
+	  add_entry (ctx, (GIdlNode *)iface);
 	  
 	  ctx->state = STATE_INTERFACE;
 	  
@@ -1198,8 +1209,7 @@ start_object (GMarkupParseContext *context,
 	    iface->deprecated = FALSE;
 	  
 	  ctx->current_node = (GIdlNode *) iface;
-	  ctx->current_module->entries = 
-	    g_list_append (ctx->current_module->entries, iface);	      
+	  add_entry (ctx, (GIdlNode *)iface);
 	  
 	  ctx->state = STATE_OBJECT;
 	}
@@ -1486,8 +1496,7 @@ start_struct (GMarkupParseContext *context,
 	    struct_->deprecated = FALSE;
 
 	  ctx->current_node = (GIdlNode *)struct_;
-	  ctx->current_module->entries = 
-	    g_list_append (ctx->current_module->entries, struct_);
+	  add_entry (ctx, (GIdlNode *)struct_);
 	  
 	  ctx->state = STATE_STRUCT;
 	    }
@@ -1535,8 +1544,7 @@ start_union (GMarkupParseContext *context,
 	    union_->deprecated = FALSE;
 
 	  ctx->current_node = (GIdlNode *)union_;
-	  ctx->current_module->entries = 
-	    g_list_append (ctx->current_module->entries, union_);
+	  add_entry (ctx, (GIdlNode *)union_);
 	  
 	  ctx->state = STATE_UNION;
 	}
@@ -1741,6 +1749,7 @@ start_element_handler (GMarkupParseContext *context,
 	  else
 	    {
 	      ctx->current_module = g_idl_module_new (name, shared_library);
+	      ctx->last_entry = NULL;
 	      ctx->modules = g_list_append (ctx->modules, ctx->current_module);
 
 	      ctx->state = STATE_NAMESPACE;
@@ -1873,6 +1882,7 @@ end_element_handler (GMarkupParseContext *context,
       if (strcmp (element_name, "namespace") == 0)
 	{
           ctx->current_module = NULL;
+          ctx->last_entry = NULL;
           ctx->state = STATE_ROOT;
         }
       break;
@@ -1881,14 +1891,14 @@ end_element_handler (GMarkupParseContext *context,
       if (strcmp (element_name, "return-type") == 0)
 	/* do nothing */ ;
 	
-      else if (ctx->current_node == g_list_last (ctx->current_module->entries)->data)
+      else if (ctx->current_node == ctx->last_entry->data)
 	{
 	  ctx->current_node = NULL;
 	  ctx->state = STATE_NAMESPACE;
 	}
       else 
 	{ 
-	  ctx->current_node = g_list_last (ctx->current_module->entries)->data;
+	  ctx->current_node = ctx->last_entry->data;
 	  if (ctx->current_node->type == G_IDL_NODE_INTERFACE)
 	    ctx->state = STATE_INTERFACE;
 	  else if (ctx->current_node->type == G_IDL_NODE_OBJECT)
@@ -1999,6 +2009,7 @@ cleanup (GMarkupParseContext *context,
   ctx->modules = NULL;
   
   ctx->current_module = NULL;
+  ctx->last_entry = NULL;
 }
 
 static GMarkupParser parser = 
@@ -2038,16 +2049,26 @@ GList *
 g_idl_parse_file (const gchar  *filename,
 		  GError      **error)
 {
-  gchar *buffer;
+  GMappedFile *mfile;
+  const gchar *buffer;
   gsize length;
   GList *modules;
 
-  if (!g_file_get_contents (filename, &buffer, &length, error))
+  /* parse the mapped file in place instead of copying it to the heap */
+  mfile = g_mapped_file_new (filename, FALSE, error);
+  if (mfile == NULL)
     return NULL;
-  
+
+  buffer = g_mapped_file_get_contents (mfile);
+  length = g_mapped_file_get_length (mfile);
+
+  /* empty files are not mapped */
+  if (buffer == NULL)
+    buffer = "";
+
   modules = g_idl_parse_string (buffer, length, error);
 
-  g_free (buffer);
+  g_mapped_file_free (mfile);
 
   return modules;
 }
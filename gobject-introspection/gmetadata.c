@@ -40,6 +40,51 @@ g_metadata_get_dir_entry (GMetadata *metadata,
   return (DirEntry *)&metadata->data[header->directory + (index - 1) * header->entry_blob_size];
 }
 
+/* returns the local entry with the given name, using the name index
+ * if the metadata has one
+ */
+DirEntry *
+g_metadata_get_dir_entry_by_name (GMetadata   *metadata,
+				  const gchar *name)
+{
+  Header *header = (Header *)metadata->data;
+  DirEntry *entry;
+  guint16 *index;
+  gint lower, upper, middle, cmp;
+
+  if (header->directory_index == 0)
+    {
+      for (middle = 1; middle <= header->n_local_entries; middle++)
+	{
+	  entry = g_metadata_get_dir_entry (metadata, middle);
+	  if (strcmp (name, g_metadata_get_string (metadata, entry->name)) == 0)
+	    return entry;
+	}
+
+      return NULL;
+    }
+
+  index = (guint16 *)&metadata->data[header->directory_index];
+
+  lower = 0;
+  upper = header->n_local_entries - 1;
+  while (lower <= upper)
+    {
+      middle = (lower + upper) / 2;
+      entry = g_metadata_get_dir_entry (metadata, index[middle]);
+
+      cmp = strcmp (name, g_metadata_get_string (metadata, entry->name));
+      if (cmp == 0)
+	return entry;
+      else if (cmp < 0)
+	upper = middle - 1;
+      else
+	lower = middle + 1;
+    }
+
+  return NULL;
+}
+
 void    
 g_metadata_check_sanity (void)
 {
@@ -1706,6 +1751,70 @@ validate_directory (GMetadata     *metadata,
   return TRUE;
 }
 
+static gboolean
+validate_directory_index (GMetadata     *metadata,
+			  GError       **error)
+{
+  Header *header = (Header *)metadata->data;
+  DirEntry *entry;
+  const gchar *name, *prev_name;
+  guint16 *index;
+  gint i;
+
+  if (header->directory_index == 0)
+    return TRUE;
+
+  if (!is_aligned (header->directory_index))
+    {
+      g_set_error (error,
+		   G_METADATA_ERROR,
+		   G_METADATA_ERROR_INVALID_DIRECTORY,
+		   "Misaligned directory index");
+      return FALSE;
+    }
+
+  if (metadata->len < header->directory_index + header->n_local_entries * sizeof (guint16))
+    {
+      g_set_error (error,
+		   G_METADATA_ERROR,
+		   G_METADATA_ERROR_INVALID,
+		   "The buffer is too short");
+      return FALSE;
+    }
+
+  index = (guint16 *)&metadata->data[header->directory_index];
+  prev_name = NULL;
+
+  for (i = 0; i < header->n_local_entries; i++)
+    {
+      if (index[i] == 0 || index[i] > header->n_local_entries)
+	{
+	  g_set_error (error,
+		       G_METADATA_ERROR,
+		       G_METADATA_ERROR_INVALID_DIRECTORY,
+		       "Invalid directory index entry");
+	  return FALSE;
+	}
+
+      /* entry names have been validated by validate_directory */
+      entry = g_metadata_get_dir_entry (metadata, index[i]);
+      name = g_metadata_get_string (metadata, entry->name);
+
+      if (prev_name && strcmp (prev_name, name) > 0)
+	{
+	  g_set_error (error,
+		       G_METADATA_ERROR,
+		       G_METADATA_ERROR_INVALID_DIRECTORY,
+		       "Directory index not sorted");
+	  return FALSE;
+	}
+
+      prev_name = name;
+    }
+
+  return TRUE;
+}
+
 static gboolean
 validate_annotations (GMetadata     *metadata, 
 		      GError       **error)
@@ -1734,6 +1843,9 @@ g_metadata_validate (GMetadata     *metadata,
   if (!validate_directory (metadata, error))
     return FALSE;
 
+  if (!validate_directory_index (metadata, error))
+    return FALSE;
+
   if (!validate_annotations (metadata, error))
     return FALSE;
 
@@ -80,8 +80,13 @@ typedef struct
   guint16 object_blob_size;
   guint16 interface_blob_size;
   guint16 union_blob_size;
-  
-  guint16 padding[7];
+
+  /* offset of n_local_entries guint16 directory indices sorted by
+   * entry name, or 0 if the metadata has no name index
+   */
+  guint32 directory_index;
+
+  guint16 padding[5];
 } Header;
 
 typedef struct
@@ -520,6 +525,8 @@ struct _GMetadata {
 
 DirEntry *g_metadata_get_dir_entry (GMetadata *metadata,
 				    guint16            index);
+DirEntry *g_metadata_get_dir_entry_by_name (GMetadata   *metadata,
+					    const gchar *name);
 
 void      g_metadata_check_sanity (void);
 
@@ -39,6 +39,7 @@
 #include "gidlwriter.h"
 #include "grealpath.h"
 
+#include <sys/stat.h>
 #ifndef _WIN32
 #include <sys/wait.h> /* waitpid */
 #endif
@@ -48,6 +49,24 @@ typedef GType (*TypeFunction) (void);
 
 static void g_igenerator_parse_macros (GIGenerator * igenerator);
 
+static guint
+csymbol_hash (gconstpointer key)
+{
+  const CSymbol *symbol = key;
+
+  return g_str_hash (symbol->ident) ^ symbol->type;
+}
+
+static gboolean
+csymbol_equal (gconstpointer a, gconstpointer b)
+{
+  const CSymbol *symbol_a = a;
+  const CSymbol *symbol_b = b;
+
+  return symbol_a->type == symbol_b->type
+    && g_str_equal (symbol_a->ident, symbol_b->ident);
+}
+
 static GIGenerator *
 g_igenerator_new (const gchar *namespace,
 		  const gchar *shared_library)
@@ -67,6 +86,8 @@ g_igenerator_new (const gchar *namespace,
   igenerator->type_by_lower_case_prefix =
     g_hash_table_new (g_str_hash, g_str_equal);
   igenerator->symbols = g_hash_table_new (g_str_hash, g_str_equal);
+  igenerator->symbol_set = g_hash_table_new (csymbol_hash, csymbol_equal);
+  igenerator->entries = g_ptr_array_new ();
 
   return igenerator;
 }
@@ -77,6 +98,8 @@ g_igenerator_free (GIGenerator *generator)
   g_free (generator->namespace);
   g_free (generator->shared_library);
   g_free (generator->lower_case_namespace);
+  g_free (generator->cache_dir);
+  g_free (generator->cache_key);
 #if 0
   g_idl_module_free (generator->module);
 #endif  
@@ -85,6 +108,8 @@ g_igenerator_free (GIGenerator *generator)
   g_hash_table_destroy (generator->type_map);
   g_hash_table_destroy (generator->type_by_lower_case_prefix);
   g_hash_table_destroy (generator->symbols);
+  g_hash_table_destroy (generator->symbol_set);
+  g_ptr_array_free (generator->entries, TRUE);
   g_list_foreach (generator->filenames, (GFunc)g_free, NULL);
   g_list_free (generator->filenames);
 #if 0
@@ -94,6 +119,58 @@ g_igenerator_free (GIGenerator *generator)
   g_free (generator);
 }
 
+static void
+g_igenerator_add_entry (GIGenerator *igenerator, GIdlNode *node)
+{
+  /* entries are sorted once all symbols have been processed */
+  g_ptr_array_add (igenerator->entries, node);
+}
+
+static gint
+compare_entries (gconstpointer a,
+		 gconstpointer b,
+		 gpointer      user_data)
+{
+  GIdlNode **nodes = user_data;
+  guint index_a = *(const guint *) a;
+  guint index_b = *(const guint *) b;
+  gint result;
+
+  result = g_idl_node_cmp (nodes[index_a], nodes[index_b]);
+  if (result != 0)
+    return result;
+
+  /* equal names, later entries go first as with g_list_insert_sorted */
+  if (index_a == index_b)
+    return 0;
+  return index_a < index_b ? 1 : -1;
+}
+
+static void
+g_igenerator_sort_entries (GIGenerator *igenerator)
+{
+  guint *order;
+  gint i;
+
+  /* sort the insertion order instead of the nodes, g_ptr_array_sort is
+   * not stable before GLib 2.32 */
+  order = g_new (guint, igenerator->entries->len);
+  for (i = 0; i < (gint) igenerator->entries->len; i++)
+    order[i] = i;
+
+  g_qsort_with_data (order, igenerator->entries->len, sizeof (guint),
+		     compare_entries, igenerator->entries->pdata);
+
+  for (i = (gint) igenerator->entries->len - 1; i >= 0; i--)
+    {
+      igenerator->module->entries =
+	g_list_prepend (igenerator->module->entries,
+			g_ptr_array_index (igenerator->entries, order[i]));
+    }
+  g_free (order);
+  g_ptr_array_set_size (igenerator->entries, 0);
+}
+
 static GIdlNodeType *
 create_node_from_gtype (GType type_id)
 {
@@ -320,9 +397,7 @@ g_igenerator_create_object (GIGenerator *igenerator,
 
   node = (GIdlNodeInterface *) g_idl_node_new (G_IDL_NODE_OBJECT);
   node->node.name = g_strdup (g_type_name (type_id));
-  igenerator->module->entries =
-    g_list_insert_sorted (igenerator->module->entries, node,
-			  (GCompareFunc) g_idl_node_cmp);
+  g_igenerator_add_entry (igenerator, (GIdlNode *) node);
   g_hash_table_insert (igenerator->type_map, node->node.name,
 		       node);
   g_hash_table_insert (igenerator->type_by_lower_case_prefix,
@@ -393,9 +468,7 @@ g_igenerator_create_interface (GIGenerator *igenerator,
       node->node.name[strlen (node->node.name) -
 			strlen ("Iface")] = '\0';
     }
-  igenerator->module->entries =
-    g_list_insert_sorted (igenerator->module->entries, node,
-			  (GCompareFunc) g_idl_node_cmp);
+  g_igenerator_add_entry (igenerator, (GIdlNode *) node);
   g_hash_table_insert (igenerator->type_map, node->node.name,
 		       node);
   g_hash_table_insert (igenerator->type_by_lower_case_prefix,
@@ -434,9 +507,7 @@ g_igenerator_create_boxed (GIGenerator *igenerator,
   GIdlNodeBoxed *node =
     (GIdlNodeBoxed *) g_idl_node_new (G_IDL_NODE_BOXED);
   node->node.name = g_strdup (g_type_name (type_id));
-  igenerator->module->entries =
-    g_list_insert_sorted (igenerator->module->entries, node,
-			  (GCompareFunc) g_idl_node_cmp);
+  g_igenerator_add_entry (igenerator, (GIdlNode *) node);
   g_hash_table_insert (igenerator->type_map, node->node.name,
 		       node);
   g_hash_table_insert (igenerator->type_by_lower_case_prefix,
@@ -457,9 +528,7 @@ g_igenerator_create_enum (GIGenerator *igenerator,
   
   node = (GIdlNodeEnum *) g_idl_node_new (G_IDL_NODE_ENUM);
   node->node.name = g_strdup (g_type_name (type_id));
-  igenerator->module->entries =
-    g_list_insert_sorted (igenerator->module->entries, node,
-			  (GCompareFunc) g_idl_node_cmp);
+  g_igenerator_add_entry (igenerator, (GIdlNode *) node);
   g_hash_table_insert (igenerator->type_map, node->node.name,
 		       node);
   g_hash_table_insert (igenerator->type_by_lower_case_prefix,
@@ -492,9 +561,7 @@ g_igenerator_create_flags (GIGenerator *igenerator,
   
   node = (GIdlNodeEnum *) g_idl_node_new (G_IDL_NODE_FLAGS);
   node->node.name = g_strdup (g_type_name (type_id));
-  igenerator->module->entries =
-    g_list_insert_sorted (igenerator->module->entries, node,
-			  (GCompareFunc) g_idl_node_cmp);
+  g_igenerator_add_entry (igenerator, (GIdlNode *) node);
   g_hash_table_insert (igenerator->type_map, node->node.name,
 		       node);
   g_hash_table_insert (igenerator->type_by_lower_case_prefix,
@@ -650,9 +717,7 @@ g_igenerator_process_function_symbol (GIGenerator * igenerator, CSymbol * sym)
       else if (strcmp (igenerator->lower_case_namespace, prefix) == 0)
 	{
 	  func->node.name = g_strdup (last_underscore + 1);
-	  igenerator->module->entries =
-	    g_list_insert_sorted (igenerator->module->entries, func,
-				  (GCompareFunc) g_idl_node_cmp);
+	  g_igenerator_add_entry (igenerator, (GIdlNode *) func);
 	  break;
 	}
       last_underscore =
@@ -665,9 +730,7 @@ g_igenerator_process_function_symbol (GIGenerator * igenerator, CSymbol * sym)
       func->node.name = sym->ident;
       func->is_constructor = FALSE;
       func->is_method = FALSE;
-      igenerator->module->entries =
-	g_list_insert_sorted (igenerator->module->entries, func,
-			      (GCompareFunc) g_idl_node_cmp);
+      g_igenerator_add_entry (igenerator, (GIdlNode *) func);
     }
 
   func->symbol = sym->ident;
@@ -714,9 +777,7 @@ g_igenerator_process_unregistered_struct_typedef (GIGenerator * igenerator,
   char *lower_case_prefix;
 
   node->node.name = sym->ident;
-  igenerator->module->entries =
-    g_list_insert_sorted (igenerator->module->entries, node,
-			  (GCompareFunc) g_idl_node_cmp);
+  g_igenerator_add_entry (igenerator, (GIdlNode *) node);
   lower_case_prefix = g_ascii_strdown (sym->ident, -1);
   g_hash_table_insert (igenerator->type_map, sym->ident, node);
   g_hash_table_insert (igenerator->type_by_lower_case_prefix,
@@ -982,9 +1043,7 @@ g_igenerator_process_union_typedef (GIGenerator * igenerator, CSymbol * sym)
       GList *member_l;
       
       node->node.name = sym->ident;
-      igenerator->module->entries =
-	g_list_insert_sorted (igenerator->module->entries, node,
-			      (GCompareFunc) g_idl_node_cmp);
+      g_igenerator_add_entry (igenerator, (GIdlNode *) node);
       lower_case_prefix = g_ascii_strdown (sym->ident, -1);
       g_hash_table_insert (igenerator->type_map, sym->ident, node);
       g_hash_table_insert (igenerator->type_by_lower_case_prefix,
@@ -1038,9 +1097,7 @@ g_igenerator_process_enum_typedef (GIGenerator * igenerator, CSymbol * sym)
 
   node = (GIdlNodeEnum *) g_idl_node_new (G_IDL_NODE_ENUM);
   node->node.name = sym->ident;
-  igenerator->module->entries =
-    g_list_insert_sorted (igenerator->module->entries, node,
-			  (GCompareFunc) g_idl_node_cmp);
+  g_igenerator_add_entry (igenerator, (GIdlNode *) node);
 
   for (member_l = enum_type->child_list; member_l != NULL;
        member_l = member_l->next)
@@ -1066,9 +1123,7 @@ g_igenerator_process_function_typedef (GIGenerator * igenerator,
     (GIdlNodeFunction *) g_idl_node_new (G_IDL_NODE_CALLBACK);
 
   gifunc->node.name = sym->ident;
-  igenerator->module->entries =
-    g_list_insert_sorted (igenerator->module->entries, gifunc,
-			  (GCompareFunc) g_idl_node_cmp);
+  g_igenerator_add_entry (igenerator, (GIdlNode *) gifunc);
 
   gifunc->symbol = sym->ident;
   gifunc->result = (GIdlNodeParam *) g_idl_node_new (G_IDL_NODE_PARAM);
@@ -1100,9 +1155,7 @@ g_igenerator_process_constant (GIGenerator * igenerator, CSymbol * sym)
   GIdlNodeConstant *giconst =
     (GIdlNodeConstant *) g_idl_node_new (G_IDL_NODE_CONSTANT);
   giconst->node.name = sym->ident;
-  igenerator->module->entries =
-    g_list_insert_sorted (igenerator->module->entries, giconst,
-			  (GCompareFunc) g_idl_node_cmp);
+  g_igenerator_add_entry (igenerator, (GIdlNode *) giconst);
 
   giconst->type = (GIdlNodeType *) g_idl_node_new (G_IDL_NODE_TYPE);
   if (sym->const_int_set)
@@ -1157,9 +1210,7 @@ g_igenerator_process_symbols (GIGenerator * igenerator)
 	      char *lower_case_prefix;
 	      
 	      node->node.name = sym->ident;
-	      igenerator->module->entries =
-		g_list_insert_sorted (igenerator->module->entries, node,
-				      (GCompareFunc) g_idl_node_cmp);
+	      g_igenerator_add_entry (igenerator, (GIdlNode *) node);
 	      lower_case_prefix = g_ascii_strdown (sym->ident, -1);
 	      g_hash_table_insert (igenerator->type_map, sym->ident, node);
 	      g_hash_table_insert (igenerator->type_by_lower_case_prefix,
@@ -1210,22 +1261,17 @@ g_igenerator_add_symbol (GIGenerator * igenerator, CSymbol * symbol)
   symbol->directives = g_slist_reverse (igenerator->directives);
   igenerator->directives = NULL;
 
-  /* that's not very optimized ! */
-  for (l = igenerator->symbol_list; l != NULL; l = l->next)
+  if (g_hash_table_lookup (igenerator->symbol_set, symbol) != NULL)
     {
-      CSymbol *other_symbol = (CSymbol *)l->data;
-      if (g_str_equal (other_symbol->ident, symbol->ident)
-          && other_symbol->type == symbol->type)
-        {
-          g_printerr ("Dropping %s duplicate\n", symbol->ident);
-          return;
-        }
-  }
+      g_printerr ("Dropping %s duplicate\n", symbol->ident);
+      return;
+    }
 
   if (found_filename || igenerator->macro_scan)
     {
       igenerator->symbol_list =
 	g_list_prepend (igenerator->symbol_list, symbol);
+      g_hash_table_insert (igenerator->symbol_set, symbol, symbol);
     }
 
   if (symbol->type == CSYMBOL_TYPE_TYPEDEF)
@@ -1279,6 +1325,8 @@ g_igenerator_generate (GIGenerator * igenerator,
 
   g_igenerator_process_symbols (igenerator);
 
+  g_igenerator_sort_entries (igenerator);
+
   g_idl_writer_save_file (igenerator->module, filename);
 }
 
@@ -1325,16 +1373,263 @@ read_identifier (FILE * f, int c, char **identifier)
   return c;
 }
 
+static gchar *
+g_igenerator_cache_path (GIGenerator *igenerator,
+			 const gchar *suffix)
+{
+  gchar *basename, *path;
+
+  basename = g_strconcat (igenerator->cache_key, suffix, NULL);
+  path = g_build_filename (igenerator->cache_dir, basename, NULL);
+  g_free (basename);
+
+  return path;
+}
+
+/* returns a checksum of the cpp options and the contents of the
+ * headers, or NULL if a header cannot be read
+ */
+static gchar *
+g_igenerator_cache_key (GIGenerator *igenerator,
+			GList       *cpp_options)
+{
+  GChecksum *checksum;
+  gchar *contents, *key;
+  gsize length;
+  GList *l;
+
+  checksum = g_checksum_new (G_CHECKSUM_SHA1);
+
+  for (l = cpp_options; l != NULL; l = l->next)
+    g_checksum_update (checksum, l->data, strlen (l->data) + 1);
+
+  for (l = igenerator->filenames; l != NULL; l = l->next)
+    {
+      if (!g_file_get_contents (l->data, &contents, &length, NULL))
+	{
+	  g_checksum_free (checksum);
+	  return NULL;
+	}
+
+      g_checksum_update (checksum, l->data, strlen (l->data) + 1);
+      g_checksum_update (checksum, (guchar *) contents, length);
+      g_free (contents);
+    }
+
+  key = g_strdup (g_checksum_get_string (checksum));
+  g_checksum_free (checksum);
+
+  return key;
+}
+
+/* checks that none of the files the cached output has been generated
+ * from, including indirectly included headers, changed since
+ */
+static gboolean
+g_igenerator_cache_is_valid (GIGenerator *igenerator)
+{
+  gchar *path, *contents;
+  gchar **lines;
+  gboolean valid;
+  struct stat buf;
+  long mtime, size;
+  int i, n;
+
+  path = g_igenerator_cache_path (igenerator, ".deps");
+  valid = g_file_get_contents (path, &contents, NULL, NULL);
+  g_free (path);
+
+  if (!valid)
+    return FALSE;
+
+  lines = g_strsplit (contents, "\n", 0);
+  g_free (contents);
+
+  for (i = 0; valid && lines[i] != NULL; i++)
+    {
+      if (lines[i][0] == '\0')
+	continue;
+
+      if (sscanf (lines[i], "%ld %ld %n", &mtime, &size, &n) != 2 ||
+	  g_stat (lines[i] + n, &buf) != 0 ||
+	  buf.st_mtime != mtime || buf.st_size != size)
+	valid = FALSE;
+    }
+
+  g_strfreev (lines);
+
+  return valid;
+}
+
 static void
-g_igenerator_parse_macros (GIGenerator * igenerator)
+add_cache_dependency (GHashTable  *deps,
+		      const gchar *line)
 {
-  GError *error = NULL;
-  char *tmp_name = NULL;
-  FILE *fmacros =
-    fdopen (g_file_open_tmp ("gen-introspect-XXXXXX.h", &tmp_name, &error),
-	    "w+");
-  g_unlink (tmp_name);
+  const gchar *start, *end;
+  gchar *filename;
+
+  /* line markers look like # 1 "/usr/include/stdio.h" 1 3 4 */
+  if (line[0] != '#')
+    return;
+
+  start = strchr (line, '"');
+  if (start == NULL)
+    return;
+  start++;
+
+  for (end = start; *end != '\0' && *end != '"'; end++)
+    if (*end == '\\' && end[1] != '\0')
+      end++;
+
+  /* skip <stdin>, <built-in> and the like */
+  if (*end != '"' || *start == '<')
+    return;
+
+  filename = g_strndup (start, end - start);
+  g_hash_table_insert (deps, g_strcompress (filename), NULL);
+  g_free (filename);
+}
+
+/* records the headers the cached output depends on, the cache entry
+ * is only used once this file exists
+ */
+static void
+g_igenerator_store_cache (GIGenerator *igenerator)
+{
+  GHashTable *deps;
+  GHashTableIter iter;
+  gpointer filename;
+  gchar line[4096];
+  gboolean line_start = TRUE;
+  struct stat buf;
+  gchar *path, *tmp_path;
+  FILE *f, *out;
+  GList *l;
+
+  deps = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+
+  for (l = igenerator->filenames; l != NULL; l = l->next)
+    g_hash_table_insert (deps, g_strdup (l->data), NULL);
+
+  path = g_igenerator_cache_path (igenerator, ".i");
+  f = fopen (path, "r");
+  g_free (path);
+
+  if (f == NULL)
+    {
+      g_hash_table_destroy (deps);
+      return;
+    }
+
+  while (fgets (line, sizeof (line), f) != NULL)
+    {
+      if (line_start)
+	add_cache_dependency (deps, line);
+      line_start = strchr (line, '\n') != NULL;
+    }
+  fclose (f);
+
+  path = g_igenerator_cache_path (igenerator, ".deps");
+  tmp_path = g_strconcat (path, ".tmp", NULL);
+  out = fopen (tmp_path, "w");
+
+  if (out != NULL)
+    {
+      g_hash_table_iter_init (&iter, deps);
+      while (g_hash_table_iter_next (&iter, &filename, NULL))
+	if (g_stat (filename, &buf) == 0)
+	  fprintf (out, "%ld %ld %s\n", (long) buf.st_mtime,
+		   (long) buf.st_size, (char *) filename);
+
+      if (fclose (out) == 0)
+	g_rename (tmp_path, path);
+      else
+	g_unlink (tmp_path);
+    }
+
+  g_free (tmp_path);
+  g_free (path);
+  g_hash_table_destroy (deps);
+}
+
+/* copies f into the cache entry with the given suffix, the copy is
+ * renamed into place only when complete so that concurrent runs with
+ * the same key never see a partially written entry
+ */
+static gboolean
+g_igenerator_write_cache_file (GIGenerator *igenerator,
+			       const gchar *suffix,
+			       FILE        *f)
+{
+  gchar *path, *tmp_path, *buffer;
+  gboolean ok = TRUE;
+  size_t n;
+  FILE *out = NULL;
+  int fd;
+
+  path = g_igenerator_cache_path (igenerator, suffix);
+  tmp_path = g_strconcat (path, ".XXXXXX", NULL);
+
+  fd = g_mkstemp (tmp_path);
+  if (fd >= 0)
+    out = fdopen (fd, "w");
+
+  if (out == NULL)
+    {
+      if (fd >= 0)
+	{
+	  close (fd);
+	  g_unlink (tmp_path);
+	}
+      g_free (tmp_path);
+      g_free (path);
+      return FALSE;
+    }
+
+  buffer = g_malloc (65536);
+
+  rewind (f);
+  while (ok && (n = fread (buffer, 1, 65536, f)) > 0)
+    {
+      if (fwrite (buffer, 1, n, out) != n)
+	ok = FALSE;
+    }
+  if (ferror (f))
+    ok = FALSE;
+  rewind (f);
+
+  g_free (buffer);
+
+  if (fclose (out) != 0)
+    ok = FALSE;
+
+  if (ok && g_rename (tmp_path, path) != 0)
+    ok = FALSE;
+
+  if (!ok)
+    g_unlink (tmp_path);
+
+  g_free (tmp_path);
+  g_free (path);
+
+  return ok;
+}
+
+/* drops the current run from the cache, no .deps file is written */
+static void
+g_igenerator_disable_cache (GIGenerator *igenerator)
+{
+  if (igenerator->verbose)
+    g_printf ("Cannot write to cache directory '%s'\n", igenerator->cache_dir);
+
+  g_free (igenerator->cache_key);
+  igenerator->cache_key = NULL;
+}
 
+static void
+g_igenerator_write_macros (GIGenerator *igenerator,
+			   FILE        *fmacros)
+{
   GList *l;
   for (l = igenerator->filenames; l != NULL; l = l->next)
     {
@@ -1454,6 +1749,36 @@ g_igenerator_parse_macros (GIGenerator * igenerator)
 
       fclose (f);
     }
+}
+
+static void
+g_igenerator_parse_macros (GIGenerator * igenerator)
+{
+  GError *error = NULL;
+  char *tmp_name = NULL;
+  FILE *fmacros = NULL;
+
+  if (igenerator->cache_hit)
+    {
+      char *path = g_igenerator_cache_path (igenerator, ".macros");
+      fmacros = fopen (path, "r");
+      g_free (path);
+    }
+
+  if (fmacros == NULL)
+    {
+      fmacros =
+	fdopen (g_file_open_tmp ("gen-introspect-XXXXXX.h", &tmp_name, &error),
+		"w+");
+      g_unlink (tmp_name);
+      g_free (tmp_name);
+
+      g_igenerator_write_macros (igenerator, fmacros);
+
+      if (igenerator->cache_key && !igenerator->cache_hit &&
+	  !g_igenerator_write_cache_file (igenerator, ".macros", fmacros))
+	g_igenerator_disable_cache (igenerator);
+    }
 
   igenerator->macro_scan = TRUE;
   rewind (fmacros);
@@ -1513,6 +1838,70 @@ g_igenerator_add_include_idl (GIGenerator *igenerator,
     }
 }		     
 
+/* waits for a cpp process streaming into the lexer, if any */
+static gboolean
+g_igenerator_stop_preprocessor (GIGenerator *igenerator)
+{
+  GPid pid = igenerator->cpp_pid;
+  int status = 0;
+
+  if (pid == 0)
+    return TRUE;
+
+  igenerator->cpp_pid = 0;
+
+#ifndef _WIN32
+  if (waitpid (pid, &status, 0) > 0)
+#else
+  /* We don't want to include <windows.h> as it clashes horribly
+   * with token names from scannerparser.h. So just declare
+   * WaitForSingleObject, GetExitCodeProcess and INFINITE here.
+   */
+  extern unsigned long __stdcall WaitForSingleObject(void*, int);
+  extern int __stdcall GetExitCodeProcess(void*, int*);
+#define INFINITE 0xffffffff
+
+  WaitForSingleObject (pid, INFINITE);
+
+  if (GetExitCodeProcess (pid, &status))
+#endif
+    {
+      if (status != 0)
+	{
+	  g_spawn_close_pid (pid);
+#ifndef _WIN32
+	  kill (pid, SIGKILL);
+#endif
+
+	  g_error ("cpp returned error code: %d\n", status);
+	  return FALSE;
+	}
+    }
+
+  g_spawn_close_pid (pid);
+
+  return TRUE;
+}
+
+/* terminates and reaps a cpp process streaming into the lexer, if any */
+static void
+g_igenerator_kill_preprocessor (GIGenerator *igenerator)
+{
+  GPid pid = igenerator->cpp_pid;
+
+  if (pid == 0)
+    return;
+
+  igenerator->cpp_pid = 0;
+
+#ifndef _WIN32
+  kill (pid, SIGKILL);
+  waitpid (pid, NULL, 0);
+#endif
+
+  g_spawn_close_pid (pid);
+}
+
 static FILE *
 g_igenerator_start_preprocessor (GIGenerator *igenerator,
 				 GList       *cpp_options)
@@ -1524,12 +1913,34 @@ g_igenerator_start_preprocessor (GIGenerator *igenerator,
   GError *error = NULL;
   FILE *f, *out;
   GPid pid;
-  int status = 0;
   int read_bytes;
   int i;
-  char **buffer;
-  int tmp;
-  char *tmpname;
+  char *buffer;
+  char *path;
+  char *tmp_name = NULL;
+
+  if (igenerator->cache_dir)
+    {
+      igenerator->cache_key = g_igenerator_cache_key (igenerator, cpp_options);
+
+      if (igenerator->cache_key && g_igenerator_cache_is_valid (igenerator))
+	{
+	  path = g_igenerator_cache_path (igenerator, ".i");
+	  f = fopen (path, "r");
+
+	  if (f)
+	    {
+	      if (igenerator->verbose)
+		g_printf ("Using cached preprocessor output '%s'\n", path);
+
+	      igenerator->cache_hit = TRUE;
+	      g_free (path);
+	      return f;
+	    }
+
+	  g_free (path);
+	}
+    }
 
   cpp_argv = g_new0 (char *, g_list_length (cpp_options) + 5);
   cpp_argv[cpp_argc++] = "cpp";
@@ -1585,70 +1996,71 @@ g_igenerator_start_preprocessor (GIGenerator *igenerator,
   fclose (f);
   close (cpp_in);
 
-  tmp = g_file_open_tmp (NULL, &tmpname, &error);
-  if (error != NULL)
-    {
-      g_error ("%s", error->message);
-      return NULL;
-    }
-
-  buffer = g_malloc0 (4096 * sizeof (char));
+  igenerator->cpp_pid = pid;
 
-  while (1)
+  out = NULL;
+  if (igenerator->cache_key)
     {
-      read_bytes = read (cpp_out, buffer, 4096);
-      if (read_bytes == 0)
-	break;
-      write (tmp, buffer, read_bytes);
+      /* invalidate the old entry, its output is replaced below */
+      path = g_igenerator_cache_path (igenerator, ".deps");
+      g_unlink (path);
+      g_free (path);
+
+      /* the lexer reads a private copy, the cache entry is only
+       * written once cpp succeeded
+       */
+      out = fdopen (g_file_open_tmp ("gen-introspect-XXXXXX.i", &tmp_name, &error),
+		    "w+");
+      if (out != NULL)
+	g_unlink (tmp_name);
+      g_free (tmp_name);
+      g_clear_error (&error);
     }
 
-  g_free (buffer);
+  if (out == NULL)
+    {
+      /* nothing to cache, stream the output directly into the lexer */
+      g_free (igenerator->cache_key);
+      igenerator->cache_key = NULL;
 
-  close (cpp_out);
+      f = fdopen (cpp_out, "r");
+      if (!f)
+	{
+	  g_error ("%s", strerror (errno));
+	  return NULL;
+	}
 
-#ifndef _WIN32
-  if (waitpid (pid, &status, 0) > 0)
-#else
-  /* We don't want to include <windows.h> as it clashes horribly
-   * with token names from scannerparser.h. So just declare
-   * WaitForSingleObject, GetExitCodeProcess and INFINITE here.
-   */
-  extern unsigned long __stdcall WaitForSingleObject(void*, int);
-  extern int __stdcall GetExitCodeProcess(void*, int*);
-#define INFINITE 0xffffffff
+      return f;
+    }
 
-  WaitForSingleObject (pid, INFINITE);
+  buffer = g_malloc (65536);
 
-  if (GetExitCodeProcess (pid, &status))
-#endif
+  while ((read_bytes = read (cpp_out, buffer, 65536)) > 0)
     {
-      if (status != 0)
+      if (fwrite (buffer, 1, read_bytes, out) != (size_t) read_bytes)
 	{
-	  g_spawn_close_pid (pid);
-#ifndef _WIN32
-	  kill (pid, SIGKILL);
-#endif
-
-	  g_error ("cpp returned error code: %d\n", status);
-	  unlink (tmpname);
-	  g_free (tmpname);
-	  return NULL;
+	  g_printerr ("Cannot store preprocessor output: %s\n", strerror (errno));
+	  break;
 	}
     }
 
-  f = fdopen (tmp, "r");
-  if (!f)
+  g_free (buffer);
+
+  close (cpp_out);
+
+  if (!g_igenerator_stop_preprocessor (igenerator) ||
+      read_bytes > 0 || fflush (out) != 0)
     {
-      g_error ("%s", strerror (errno));
-      unlink (tmpname);
-      g_free (tmpname);
+      fclose (out);
       return NULL;
     }
-  rewind (f);
-  unlink (tmpname);
-  g_free (tmpname);
 
-  return f;
+  if (!g_igenerator_write_cache_file (igenerator, ".i", out))
+    g_igenerator_disable_cache (igenerator);
+
+  rewind (out);
+
+  return out;
 }
 
 
@@ -1667,6 +2079,7 @@ main (int argc, char **argv)
   gchar *shared_library = NULL;
   gchar **include_idls = NULL;
   gchar *output = NULL;
+  gchar *cache_dir = NULL;
   gboolean verbose = FALSE;
 
   GIGenerator *igenerator;
@@ -1691,6 +2104,8 @@ main (int argc, char **argv)
 	"Shared library which contains the symbols", "FILE" }, 
       { "include-idl", 0, 0, G_OPTION_ARG_STRING_ARRAY, &include_idls,
 	"Other gidls to include", "IDL" },
+      { "cache-dir", 0, 0, G_OPTION_ARG_FILENAME, &cache_dir,
+	"Cache preprocessor output in DIRECTORY", "DIRECTORY" },
       { NULL }
     };
 
@@ -1771,6 +2186,17 @@ main (int argc, char **argv)
   if (verbose)
     g_igenerator_set_verbose (igenerator, TRUE);
 
+  if (cache_dir)
+    {
+      if (g_mkdir_with_parents (cache_dir, 0755) == 0)
+	igenerator->cache_dir = cache_dir;
+      else
+	{
+	  g_printerr ("WARNING: cannot create cache directory %s\n", cache_dir);
+	  g_free (cache_dir);
+	}
+    }
+
   if (!filenames)
     {
       g_printerr ("ERROR: Need at least one header file.\n");
@@ -1803,6 +2229,15 @@ main (int argc, char **argv)
     }
 
   if (!g_igenerator_parse_file (igenerator, tmp))
+    {
+      /* cpp may still be blocked writing to the pipe */
+      fclose (tmp);
+      g_igenerator_kill_preprocessor (igenerator);
+      g_igenerator_free (igenerator);  
+      return 1;
+    }
+
+  if (!g_igenerator_stop_preprocessor (igenerator))
     {
       fclose (tmp);
       g_igenerator_free (igenerator);  
@@ -1811,6 +2246,9 @@ main (int argc, char **argv)
 
   g_igenerator_parse_macros (igenerator);
 
+  if (igenerator->cache_key && !igenerator->cache_hit)
+    g_igenerator_store_cache (igenerator);
+
   g_igenerator_generate (igenerator, output, libraries);
 
   fclose (tmp);
@@ -39,22 +39,31 @@ struct _GIGenerator
   char *shared_library;
   char *lower_case_namespace;
   gboolean verbose;
+  /* directory for cached preprocessor output, or NULL */
+  char *cache_dir;
 
   /* specified files to be parsed */
   GList *filenames;
   /* source reference of current lexer position */
   char *current_filename;
   GList *symbol_list;
+  GHashTable *symbol_set; /* symbol_list indexed by (ident, type) */
   GHashTable *typedef_table;
   GHashTable *struct_or_union_or_enum_table;
 
   GIdlModule *module;
+  GPtrArray *entries; /* module entries, sorted when generating */
   GList *get_type_symbols;
   GHashTable *type_map;
   GHashTable *type_by_lower_case_prefix;
 
   GHashTable *symbols; /* typename -> module.name */
 
+  /* preprocessor state */
+  GPid cpp_pid; /* running cpp streaming into the lexer, or 0 */
+  char *cache_key; /* checksum of headers and cpp options */
+  gboolean cache_hit;
+
   /* scanner variables */
   gboolean macro_scan;
   GSList *directives; /* list of CDirective for the current symbol */
@@ -120,6 +120,41 @@ void test_inline_array () {
 	assert (1 in a);
 }
 
+void test_reserve_append () {
+	int[] a = {};
+	a.reserve (16);
+	a += 1;
+	a.append (new int[] { 2, 3 });
+	assert (a.length == 3);
+	assert (a[2] == 3);
+
+	string[] s = { "foo" };
+	string[] t = { "bar", "baz" };
+	s.append (t);
+	t[0] = "manam";
+	assert (s.length == 3);
+	assert (s[1] == "bar");
+	assert (s[3] == null);
+
+	// appending an array to itself must not read the renewed block
+	int[] b = { 1, 2 };
+	b.append (b);
+	assert (b.length == 4);
+	assert (b[2] == 1 && b[3] == 2);
+
+	string[] u = { "foo", "bar" };
+	u.append (u);
+	assert (u.length == 4);
+	assert (u[2] == "foo" && u[3] == "bar");
+	assert (u[4] == null);
+
+	// and likewise for a slice of itself
+	int[] c = { 1, 2, 3 };
+	c.append (c[1:3]);
+	assert (c.length == 5);
+	assert (c[3] == 2 && c[4] == 3);
+}
+
 void main () {
 	test_integer_array ();
 	test_string_array ();
@@ -128,4 +163,5 @@ void main () {
 	test_reference_transfer ();
 	test_length_assignment ();
 	test_inline_array ();
+	test_reserve_append ();
 }
@@ -35,6 +35,62 @@ void test_string () {
 	assert (t[1] == 'l');
 }
 
+void test_string_template () {
+	int i = 42;
+	uint u = 7;
+	char c = 'x';
+	string s = "foo";
+
+	// formatted in a single step
+	string t = @"$i $u 100%";
+	assert (t == "42 7 100%");
+
+	t = @"$i $u $c $s 100%";
+	assert (t == "42 7 x foo 100%");
+
+	t = @"$(i + 1)-$(s.length)";
+	assert (t == "43-3");
+
+	// values without printf conversion
+	bool b = true;
+	t = @"$s $b";
+	assert (t == "foo true");
+
+	// null strings and nul characters are not formatted by printf
+	string? n = null;
+	t = @"$i$(n ?? "")x$u";
+	assert (t == "42x7");
+	c = '\0';
+	t = @"a$(c)b$i";
+	assert (t == "ab42");
+}
+
+void test_string_append () {
+	string s = "";
+	for (int i = 0; i < 100; i++) {
+		s += "ab";
+	}
+	assert (s.length == 200);
+	assert (s.has_prefix ("abab"));
+
+	// append string to itself
+	s = "xy";
+	s += s;
+	s += s.offset (1);
+	assert (s == "xyxyyxy");
+
+	// reset by assignment
+	s = "foo";
+	s += "bar";
+	assert (s == "foobar");
+
+	string? n = null;
+	n += "foo";
+	assert (n == null);
+}
+
 void main () {
 	test_string ();
+	test_string_template ();
+	test_string_append ();
 }
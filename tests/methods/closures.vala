@@ -28,6 +28,33 @@ void B ([CCode (array_length = false, array_null_terminated = true)] int[] array
 	Func C = () => { array = null; func (); return 0; };
 }
 
+delegate void IterateFunc (int i);
+
+void iterate (int n, IterateFunc func) {
+	for (int i = 0; i < n; i++) {
+		func (i);
+	}
+}
+
+void test_unowned_closures () {
+	int sum = 0;
+	for (int i = 0; i < 10; i++) {
+		int factor = i;
+		iterate (3, (j) => {
+			sum += factor * j;
+		});
+	}
+	assert (sum == 135);
+
+	// closure escapes through nested lambda expression
+	Func f = null;
+	iterate (1, (j) => {
+		f = () => sum;
+	});
+	sum++;
+	assert (f () == 136);
+}
+
 void main () {
 	int result = A (10, () => 1, () => -1, () => -1, () => 1, () => 0);
 	assert (result == -67);
@@ -37,5 +64,7 @@ void main () {
 	foo.bar (loop);
 	loop.run ();
 	assert (foo.ref_count == 1);
+
+	test_unowned_closures ();
 }
 
@@ -0,0 +1,41 @@
+public struct Point {
+	public int x;
+	public int y;
+
+	[CCode (header_inline = true)]
+	public inline int sum () {
+		return x + y;
+	}
+}
+
+public class Counter {
+	public int count;
+	public double scale = 1.0;
+
+	[CCode (header_inline = true)]
+	public inline void reset (int start) {
+		count = start;
+	}
+
+	[CCode (header_inline = true)]
+	public inline int next () {
+		count += 1;
+		return count;
+	}
+
+	[CCode (header_inline = true)]
+	public inline bool is_scaled () {
+		return scale != 1.0;
+	}
+}
+
+void main () {
+	var p = Point () { x = 1, y = 2 };
+	assert (p.sum () == 3);
+
+	var counter = new Counter ();
+	counter.reset (10);
+	assert (counter.next () == 11);
+	assert (counter.count == 11);
+	assert (!counter.is_scaled ());
+}
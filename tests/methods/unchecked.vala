@@ -0,0 +1,63 @@
+public struct Bar {
+	public int i;
+
+	[CCode (cname = "unchecked_bar_add")]
+	public int add (string s) {
+		i += s.length;
+		return i;
+	}
+}
+
+// the checked public function of Bar.add
+[CCode (cname = "unchecked_bar_add")]
+extern int bar_add (ref Bar bar, string s);
+
+delegate int FooFunc (Foo foo, string s);
+delegate int AddFunc (string s);
+
+public class Foo {
+	public int count;
+
+	public int add (string s) {
+		count += s.length;
+		return count;
+	}
+
+	public int add_bar (Bar bar, ref string s) {
+		s = s + "x";
+		return add (s) + bar.i;
+	}
+
+	public string? maybe (string? s) {
+		return s;
+	}
+}
+
+int call (Foo foo, string s) {
+	return foo.add (s);
+}
+
+void main () {
+	var foo = new Foo ();
+	assert (foo.add ("abc") == 3);
+
+	var bar = Bar () { i = 10 };
+	string s = "de";
+	assert (foo.add_bar (bar, ref s) == 16);
+	assert (s == "dex");
+
+	assert (foo.maybe (null) == null);
+	assert (foo.maybe ("foo") == "foo");
+
+	// method references go through the checked public function
+	FooFunc func = call;
+	assert (func (foo, "f") == 7);
+
+	// instance methods used as delegates too
+	AddFunc add = foo.add;
+	assert (add ("gh") == 9);
+
+	assert (bar.add ("abc") == 13);
+	assert (bar_add (ref bar, "de") == 15);
+	assert (bar.i == 15);
+}
@@ -0,0 +1,34 @@
+class Foo : Object {
+	public virtual int foo () {
+		return 1;
+	}
+
+	public virtual int bar () {
+		return 10;
+	}
+}
+
+class Bar : Foo {
+	public override int foo () {
+		return 2;
+	}
+}
+
+class Baz : Bar {
+	public virtual int baz () {
+		return foo () + bar ();
+	}
+}
+
+void main () {
+	Foo foo = new Bar ();
+	assert (foo.foo () == 2);
+	assert (foo.bar () == 10);
+
+	var baz = new Baz ();
+	assert (baz.foo () == 2);
+	assert (baz.baz () == 12);
+
+	foo = baz;
+	assert (foo.foo () == 2);
+}
@@ -11,6 +11,11 @@ public class NonPrivAccess : Object {
 	public RealStruct real_struct { get; set; }
 }
 
+public class AutoProperties : Object {
+	public int count { get; set; }
+	public string label { get; set; }
+}
+
 public class Sample : Object {
 	private string automatic { get; set; }
 
@@ -75,6 +80,16 @@ public class Sample : Object {
 		nonpriv.real_struct = { 10 };
 		assert (nonpriv.real_struct.field == 10);
 
+		var auto = new AutoProperties ();
+		int notified = 0;
+		auto.notify["count"].connect (() => notified++);
+		auto.count = 5;
+		auto.count += 1;
+		auto.label = "foo";
+		assert (auto.count == 6);
+		assert (notified == 2);
+		assert (auto.label == "foo");
+
 		return 0;
 	}
 }
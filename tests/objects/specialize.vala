@@ -0,0 +1,46 @@
+[Specialize]
+class Stack<G> : Object {
+	G[] items = new G[4];
+	int length;
+
+	public void push (G item) {
+		if (length == items.length) {
+			items.resize (2 * items.length);
+		}
+		items[length++] = item;
+	}
+
+	public G pop () {
+		return items[--length];
+	}
+
+	public int size {
+		get { return length; }
+	}
+}
+
+[Specialize]
+class Box<G> {
+	public G value;
+
+	public Box (G value) {
+		this.value = value;
+	}
+}
+
+void main () {
+	var stack = new Stack<int> ();
+	for (int i = 0; i < 10; i++) {
+		stack.push (i);
+	}
+	assert (stack.size == 10);
+	assert (stack.pop () == 9);
+
+	string s = "foo";
+	var box = new Box<unowned string> (s);
+	assert (box.value == "foo");
+
+	var pointers = new Stack<void*> ();
+	pointers.push (&s);
+	assert (pointers.pop () == &s);
+}
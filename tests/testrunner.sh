@@ -48,6 +48,9 @@ function testheader() {
 		echo 'trap "kill $DBUS_SESSION_BUS_PID" INT TERM EXIT' >> prepare
 	elif [ "$1" = "GIR" ]; then
 		GIRTEST=1
+	elif [ "$1" = "Flags:" ]; then
+		shift
+		TESTFLAGS="$@"
 	fi
 }
 
@@ -57,9 +60,14 @@ function sourceheader() {
 		ns=${testpath//\//.}
 		ns=${ns//-/_}
 		SOURCEFILE=$ns.vala
-		SOURCEFILES="$SOURCEFILES $SOURCEFILE"
-		echo "	case \"/$testpath\": $ns.main (); break;" >> main.vala
-		echo "namespace $ns {" > $SOURCEFILE
+		if [ -n "$TESTFLAGS" ]; then
+			# built on its own, see sourceend
+			echo -n > $SOURCEFILE
+		else
+			SOURCEFILES="$SOURCEFILES $SOURCEFILE"
+			echo "	case \"/$testpath\": $ns.main (); break;" >> main.vala
+			echo "namespace $ns {" > $SOURCEFILE
+		fi
 	elif [ $GIRTEST -eq 1 ]; then
 		if [ "$1" = "Input:" ]; then
 			testpath=${testfile/.test/}
@@ -97,6 +105,11 @@ function sourceend() {
 				echo "</repository>" >> $SOURCEFILE
 			fi
 			echo "$VAPIGEN $VAPIGENFLAGS --library $ns $ns.gir && tail -n +5 $ns.vapi|sed '\$d'|diff -wu $ns.vapi.ref -" > check
+		elif [ -n "$TESTFLAGS" ]; then
+			# keep warnings, so that flags like --fatal-warnings catch
+			# attributes the compiler ignores for this configuration
+			echo "$VALAC ${VALAFLAGS/--disable-warnings /} $TESTFLAGS -o $ns$EXEEXT $([ -z "$PACKAGES" ] || echo $PACKAGES | xargs -n 1 echo -n " --pkg") $SOURCEFILE" > check
+			echo "./$ns$EXEEXT" >> check
 		else
 			echo "}" >> $SOURCEFILE
 			echo "./test$EXEEXT /$testpath" > check
@@ -146,6 +159,7 @@ for testfile in "$@"; do
 		PART=0
 		INHEADER=1
 		GIRTEST=0
+		TESTFLAGS=
 		testpath=
 		while IFS="" read -r line; do
 			if [ $PART -eq 0 ]; then
@@ -88,6 +88,10 @@ public class Vala.AddressofExpression : Expression {
 		var ea = inner as ElementAccess;
 		if (inner is MemberAccess && inner.symbol_reference is Variable) {
 			// address of variable is always possible
+			var local = inner.symbol_reference as LocalVariable;
+			if (local != null) {
+				local.address_taken = true;
+			}
 		} else if (ea != null &&
 		           (ea.container.value_type is ArrayType || ea.container.value_type is PointerType)) {
 			// address of element of regular array or pointer is always possible
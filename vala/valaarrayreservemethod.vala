@@ -0,0 +1,35 @@
+/* valaarrayreservemethod.vala
+ *
+ * Copyright (C) 2026  The Vala developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ */
+
+using GLib;
+
+/**
+ * Represents the Array.reserve method.
+ */
+public class Vala.ArrayReserveMethod : Method {
+	/**
+	 * Creates a new array reserve method.
+	 *
+	 * @return newly created method
+	 */
+	public ArrayReserveMethod (SourceReference source_reference) {
+		base ("reserve", new VoidType (), source_reference);
+		external = true;
+	}
+}
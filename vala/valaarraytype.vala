@@ -67,6 +67,8 @@ public class Vala.ArrayType : ReferenceType {
 	private ArrayLengthField length_field;
 	private ArrayResizeMethod resize_method;
 	private ArrayMoveMethod move_method;
+	private ArrayReserveMethod reserve_method;
+	private ArrayAppendMethod append_method;
 
 	public ArrayType (DataType element_type, int rank, SourceReference? source_reference) {
 		this.element_type = element_type;
@@ -84,6 +86,16 @@ public class Vala.ArrayType : ReferenceType {
 				return null;
 			}
 			return get_resize_method ();
+		} else if (member_name == "reserve") {
+			if (rank > 1) {
+				return null;
+			}
+			return get_reserve_method ();
+		} else if (member_name == "append") {
+			if (rank > 1) {
+				return null;
+			}
+			return get_append_method ();
 		}
 		return null;
 	}
@@ -145,6 +157,44 @@ public class Vala.ArrayType : ReferenceType {
 		return move_method;
 	}
 
+	private ArrayReserveMethod get_reserve_method () {
+		if (reserve_method == null) {
+			reserve_method = new ArrayReserveMethod (source_reference);
+
+			reserve_method.return_type = new VoidType ();
+			reserve_method.access = SymbolAccessibility.PUBLIC;
+
+			reserve_method.set_attribute_string ("CCode", "cname", "_vala_array_reserve");
+
+			var root_symbol = source_reference.file.context.root;
+			var int_type = new IntegerType ((Struct) root_symbol.scope.lookup ("int"));
+
+			reserve_method.add_parameter (new Parameter ("capacity", int_type));
+
+			reserve_method.returns_modified_pointer = true;
+		}
+		return reserve_method;
+	}
+
+	private ArrayAppendMethod get_append_method () {
+		if (append_method == null) {
+			append_method = new ArrayAppendMethod (source_reference);
+
+			append_method.return_type = new VoidType ();
+			append_method.access = SymbolAccessibility.PUBLIC;
+
+			append_method.set_attribute_string ("CCode", "cname", "_vala_array_append");
+
+			var values_type = new ArrayType (element_type.copy (), 1, source_reference);
+			values_type.value_owned = false;
+
+			append_method.add_parameter (new Parameter ("values", values_type));
+
+			append_method.returns_modified_pointer = true;
+		}
+		return append_method;
+	}
+
 	public override DataType copy () {
 		var result = new ArrayType (element_type.copy (), rank, source_reference);
 		result.value_owned = value_owned;
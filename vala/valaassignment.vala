@@ -254,6 +254,14 @@ public class Vala.Assignment : Expression {
 				right = bin;
 				right.check (context);
 
+				var local = ma.symbol_reference as LocalVariable;
+				if (local != null && bin.operator == BinaryOperator.PLUS
+				    && local.variable_type.value_owned
+				    && bin.value_type != null && bin.value_type.data_type == context.analyzer.string_type.data_type) {
+					// allows codegen to extend the string in place
+					local.string_append = true;
+				}
+
 				operator = AssignmentOperator.SIMPLE;
 			}
 		}
@@ -456,6 +464,24 @@ public class Vala.Assignment : Expression {
 		return false;
 	}
 
+	/**
+	 * Returns whether this assignment appends to a string local in place.
+	 * Only the appended operand is emitted for such assignments.
+	 */
+	public bool is_string_append () {
+		var local = left.symbol_reference as LocalVariable;
+		var binary = right as BinaryExpression;
+		if (local != null && local.is_appendable_string ()) {
+			if (binary != null && binary.operator == BinaryOperator.PLUS) {
+				if (left.symbol_reference == binary.left.symbol_reference) {
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
 	public override void emit (CodeGenerator codegen) {
 		var ma = left as MemberAccess;
 		var ea = left as ElementAccess;
@@ -472,6 +498,7 @@ public class Vala.Assignment : Expression {
 			if (operator == AssignmentOperator.SIMPLE &&
 			    (local != null || param != null || field != null) &&
 			    !is_array_add () &&
+			    !is_string_append () &&
 			    !(field is ArrayLengthField) &&
 				!(left.value_type.is_real_non_null_struct_type () && right is ObjectCreationExpression)) {
 				// visit_assignment not necessary
@@ -530,7 +557,12 @@ public class Vala.Assignment : Expression {
 			pi.emit (codegen);
 		}
 
-		right.emit (codegen);
+		if (is_string_append ()) {
+			// the string is extended in place, the concatenation is not evaluated
+			((BinaryExpression) right).right.emit (codegen);
+		} else {
+			right.emit (codegen);
+		}
 
 		codegen.visit_assignment (this);
 
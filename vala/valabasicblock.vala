@@ -30,15 +30,15 @@ public class Vala.BasicBlock {
 	private List<CodeNode> nodes = new ArrayList<CodeNode> ();
 
 	// control flow graph
-	private List<weak BasicBlock> predecessors = new ArrayList<weak BasicBlock> ();
-	private List<BasicBlock> successors = new ArrayList<BasicBlock> ();
+	private List<weak BasicBlock> predecessors = new SmallList<weak BasicBlock> ();
+	private List<BasicBlock> successors = new SmallList<BasicBlock> ();
 
 	// dominator tree
 	public BasicBlock parent { get; private set; }
 	List<BasicBlock> children = new ArrayList<BasicBlock> ();
-	Set<BasicBlock> df = new HashSet<BasicBlock> ();
+	List<BasicBlock> df = new ArrayList<BasicBlock> ();
 
-	Set<PhiFunction> phi_functions = new HashSet<PhiFunction> ();
+	List<PhiFunction> phi_functions = new ArrayList<PhiFunction> ();
 
 	public bool postorder_visited { get; set; }
 	public int postorder_number { get; set; }
@@ -87,10 +87,12 @@ public class Vala.BasicBlock {
 	}
 
 	public void add_dominator_frontier (BasicBlock block) {
-		df.add (block);
+		if (!df.contains (block)) {
+			df.add (block);
+		}
 	}
 
-	public Set<BasicBlock> get_dominator_frontier () {
+	public List<BasicBlock> get_dominator_frontier () {
 		return df;
 	}
 
@@ -98,7 +100,7 @@ public class Vala.BasicBlock {
 		phi_functions.add (phi);
 	}
 
-	public Set<PhiFunction> get_phi_functions () {
+	public List<PhiFunction> get_phi_functions () {
 		return phi_functions;
 	}
 }
@@ -34,7 +34,13 @@ public class Vala.Block : Symbol, Statement {
 
 	public bool captured { get; set; }
 
-	private List<Statement> statement_list = new ArrayList<Statement> ();
+	/**
+	 * Specifies whether closures capturing this block may outlive the
+	 * execution of the block.
+	 */
+	public bool escaping { get; set; }
+
+	private List<Statement> statement_list = new SmallList<Statement> ();
 	private List<LocalVariable> local_variables = new ArrayList<LocalVariable> ();
 	private List<Constant> local_constants = new ArrayList<Constant> ();
 	
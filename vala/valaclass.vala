@@ -62,6 +62,16 @@ public class Vala.Class : ObjectTypeSymbol {
 		}
 	}
 
+	/**
+	 * Specialized classes only accept type arguments that do not require
+	 * memory management, elements are never copied or destroyed.
+	 */
+	public bool is_specialized {
+		get {
+			return get_attribute ("Specialize") != null;
+		}
+	}
+
 	/**
 	 * Instances of immutable classes are immutable after construction.
 	 */
@@ -0,0 +1,76 @@
+/* valaclasshierarchyanalyzer.vala
+ *
+ * Copyright (C) 2026  The Vala developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ */
+
+using GLib;
+
+/**
+ * Code visitor marking virtual methods that are overridden by a subclass
+ * in the compiled sources.
+ */
+public class Vala.ClassHierarchyAnalyzer : CodeVisitor {
+	public ClassHierarchyAnalyzer () {
+	}
+
+	/**
+	 * Analyze the class hierarchy in the specified context.
+	 *
+	 * @param context a code context
+	 */
+	public void analyze (CodeContext context) {
+		/* overrides can only be declared in non-pkg source files */
+		var source_files = context.get_source_files ();
+		foreach (SourceFile file in source_files) {
+			if (file.file_type == SourceFileType.SOURCE) {
+				file.accept (this);
+			}
+		}
+	}
+
+	public override void visit_source_file (SourceFile source_file) {
+		source_file.accept_children (this);
+	}
+
+	public override void visit_namespace (Namespace ns) {
+		ns.accept_children (this);
+	}
+
+	public override void visit_class (Class cl) {
+		cl.accept_children (this);
+	}
+
+	public override void visit_method (Method m) {
+		if (!m.overrides || m.base_method == null || m.base_method == m) {
+			return;
+		}
+
+		// every implementation inherited by this class may now be bypassed
+		var cl = ((Class) m.parent_symbol).base_class;
+		while (cl != null) {
+			var sym = cl.scope.lookup (m.name);
+			if (sym is Signal) {
+				sym = ((Signal) sym).default_handler;
+			}
+			var base_impl = sym as Method;
+			if (base_impl != null && (base_impl == m.base_method || base_impl.base_method == m.base_method)) {
+				base_impl.overridden = true;
+			}
+			cl = cl.base_class;
+		}
+	}
+}
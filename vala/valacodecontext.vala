@@ -46,6 +46,12 @@ public class Vala.CodeContext {
 	 */
 	public bool hide_internal { get; set; }
 
+	/**
+	 * Assume that no code outside of this compilation derives from the
+	 * compiled classes.
+	 */
+	public bool whole_program { get; set; }
+
 	/**
 	 * Do not warn when using experimental features.
 	 */
@@ -225,6 +231,8 @@ public class Vala.CodeContext {
 
 	public FlowAnalyzer flow_analyzer { get; private set; }
 
+	public ClassHierarchyAnalyzer hierarchy_analyzer { get; private set; }
+
 	/**
 	 * The selected code generator.
 	 */
@@ -239,6 +247,7 @@ public class Vala.CodeContext {
 		resolver = new SymbolResolver ();
 		analyzer = new SemanticAnalyzer ();
 		flow_analyzer = new FlowAnalyzer ();
+		hierarchy_analyzer = new ClassHierarchyAnalyzer ();
 		used_attr = new UsedAttr ();
 	}
 
@@ -484,6 +493,8 @@ public class Vala.CodeContext {
 			return;
 		}
 
+		hierarchy_analyzer.analyze (this);
+
 		flow_analyzer.analyze (this);
 	}
 
@@ -69,7 +69,7 @@ public abstract class Vala.DataType : CodeNode {
 	 */
 	public void add_type_argument (DataType arg) {
 		if (type_argument_list == null) {
-			type_argument_list = new ArrayList<DataType> ();
+			type_argument_list = new SmallList<DataType> ();
 		}
 		type_argument_list.add (arg);
 		arg.parent_node = this;
@@ -467,10 +467,11 @@ public abstract class Vala.DataType : CodeNode {
 	 * value_type.
 	 */
 	public virtual DataType? infer_type_argument (TypeParameter type_param, DataType value_type) {
-		var value_type_arg_it = value_type.get_type_arguments ().iterator ();
+		var value_type_args = value_type.get_type_arguments ();
+		int index = 0;
 		foreach (var formal_type_arg in this.get_type_arguments ()) {
-			if (value_type_arg_it.next ()) {
-				var inferred_type = formal_type_arg.infer_type_argument (type_param, value_type_arg_it.get ());
+			if (index < value_type_args.size) {
+				var inferred_type = formal_type_arg.infer_type_argument (type_param, value_type_args[index++]);
 				if (inferred_type != null) {
 					return inferred_type;
 				}
@@ -334,56 +334,59 @@ public class Vala.FlowAnalyzer : CodeVisitor {
 		}
 	}
 
-	Map<Variable, Set<BasicBlock>> get_assignment_map (List<BasicBlock> block_list, BasicBlock entry_block) {
-		var map = new HashMap<Variable, Set<BasicBlock>> ();
+	Map<Variable, List<BasicBlock>> get_assignment_map (List<BasicBlock> block_list, BasicBlock entry_block, List<Variable> assigned_variables) {
+		var map = new HashMap<Variable, List<BasicBlock>> ();
+		var defined_variables = new ArrayList<Variable> ();
 		foreach (BasicBlock block in block_list) {
-			var defined_variables = new ArrayList<Variable> ();
+			defined_variables.clear ();
 			foreach (CodeNode node in block.get_nodes ()) {
 				node.get_defined_variables (defined_variables);
 			}
 
 			foreach (Variable variable in defined_variables) {
-				var block_set = map.get (variable);
-				if (block_set == null) {
-					block_set = new HashSet<BasicBlock> ();
-					map.set (variable, block_set);
+				var variable_blocks = map.get (variable);
+				if (variable_blocks == null) {
+					variable_blocks = new ArrayList<BasicBlock> ();
+					map.set (variable, variable_blocks);
+					assigned_variables.add (variable);
+				}
+				// blocks are processed one after another, duplicates can only be adjacent
+				if (variable_blocks.size == 0 || variable_blocks[variable_blocks.size - 1] != block) {
+					variable_blocks.add (block);
 				}
-				block_set.add (block);
 			}
 		}
 		return map;
 	}
 
 	void insert_phi_functions (List<BasicBlock> block_list, BasicBlock entry_block) {
-		var assign = get_assignment_map (block_list, entry_block);
+		var assigned_variables = new ArrayList<Variable> ();
+		var assign = get_assignment_map (block_list, entry_block, assigned_variables);
 
 		int counter = 0;
 		var work_list = new ArrayList<BasicBlock> ();
 
-		var added = new HashMap<BasicBlock, int> ();
-		var phi = new HashMap<BasicBlock, int> ();
-		foreach (BasicBlock block in block_list) {
-			added.set (block, 0);
-			phi.set (block, 0);
-		}
+		// indexed by postorder number
+		var added = new int[block_list.size];
+		var phi = new int[block_list.size];
 
-		foreach (Variable variable in assign.get_keys ()) {
+		foreach (Variable variable in assigned_variables) {
 			counter++;
 			foreach (BasicBlock block in assign.get (variable)) {
 				work_list.add (block);
-				added.set (block, counter);
+				added[block.postorder_number] = counter;
 			}
 			while (work_list.size > 0) {
 				BasicBlock block = work_list.get (0);
 				work_list.remove_at (0);
 				foreach (BasicBlock frontier in block.get_dominator_frontier ()) {
-					int blockPhi = phi.get (frontier);
+					int blockPhi = phi[frontier.postorder_number];
 					if (blockPhi < counter) {
 						frontier.add_phi_function (new PhiFunction (variable, frontier.get_predecessors ().size));
-						phi.set (frontier, counter);
-						int block_added = added.get (frontier);
+						phi[frontier.postorder_number] = counter;
+						int block_added = added[frontier.postorder_number];
 						if (block_added < counter) {
-							added.set (frontier, counter);
+							added[frontier.postorder_number] = counter;
 							work_list.add (frontier);
 						}
 					}
@@ -437,8 +440,11 @@ public class Vala.FlowAnalyzer : CodeVisitor {
 			phi_functions.set (versioned_var, phi);
 		}
 
+		var used_variables = new ArrayList<Variable> ();
+		var defined_variables = new ArrayList<Variable> ();
+
 		foreach (CodeNode node in block.get_nodes ()) {
-			var used_variables = new ArrayList<Variable> ();
+			used_variables.clear ();
 			node.get_used_variables (used_variables);
 			
 			foreach (Variable var_symbol in used_variables) {
@@ -459,7 +465,7 @@ public class Vala.FlowAnalyzer : CodeVisitor {
 				used_vars.add (versioned_variable);
 			}
 
-			var defined_variables = new ArrayList<Variable> ();
+			defined_variables.clear ();
 			node.get_defined_variables (defined_variables);
 
 			foreach (Variable variable in defined_variables) {
@@ -493,7 +499,7 @@ public class Vala.FlowAnalyzer : CodeVisitor {
 			variable_stack.remove_at (variable_stack.size - 1);
 		}
 		foreach (CodeNode node in block.get_nodes ()) {
-			var defined_variables = new ArrayList<Variable> ();
+			defined_variables.clear ();
 			node.get_defined_variables (defined_variables);
 
 			foreach (Variable variable in defined_variables) {
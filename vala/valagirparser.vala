@@ -141,20 +141,99 @@ public class Vala.GirParser : CodeVisitor {
 		public Vala.Map<ArgumentType,Argument> args = new HashMap<ArgumentType,Argument> ();
 		public ArrayList<Metadata> children = new ArrayList<Metadata> ();
 
+		// patterns without wildcards are matched by name
+		bool has_wildcard;
+		string literal_prefix;
+
+		// positions of children by name and by the literal prefix of their pattern
+		Vala.Map<string,ArrayList<int>> literal_children;
+		Vala.Map<string,ArrayList<int>> prefix_children;
+		int max_prefix_length;
+		Vala.Map<string,Metadata> match_cache;
+
 		public Metadata (string pattern, string? selector = null, SourceReference? source_reference = null) {
 			this.pattern_spec = new PatternSpec (pattern);
 			this.selector = selector;
 			this.source_reference = source_reference;
+
+			int wildcard = 0;
+			while (wildcard < pattern.length && pattern[wildcard] != '*' && pattern[wildcard] != '?') {
+				wildcard++;
+			}
+			has_wildcard = wildcard < pattern.length;
+			literal_prefix = pattern.substring (0, wildcard);
 		}
 
 		public void add_child (Metadata metadata) {
 			children.add (metadata);
+			match_cache = null;
+		}
+
+		void index_children () {
+			literal_children = new HashMap<string,ArrayList<int>> (str_hash, str_equal);
+			prefix_children = new HashMap<string,ArrayList<int>> (str_hash, str_equal);
+			max_prefix_length = 0;
+			match_cache = new HashMap<string,Metadata> (str_hash, str_equal);
+
+			for (int i = 0; i < children.size; i++) {
+				var child = children[i];
+				var map = child.has_wildcard ? prefix_children : literal_children;
+				var positions = map[child.literal_prefix];
+				if (positions == null) {
+					positions = new ArrayList<int> ();
+					map[child.literal_prefix] = positions;
+				}
+				positions.add (i);
+
+				if (child.has_wildcard && child.literal_prefix.length > max_prefix_length) {
+					max_prefix_length = child.literal_prefix.length;
+				}
+			}
+		}
+
+		static void add_candidates (ArrayList<int> candidates, ArrayList<int>? positions) {
+			if (positions == null) {
+				return;
+			}
+			// keep the candidates in the order of the children
+			foreach (var position in positions) {
+				int i = candidates.size;
+				while (i > 0 && candidates[i - 1] > position) {
+					i--;
+				}
+				candidates.insert (i, position);
+			}
 		}
 
 		public Metadata match_child (string name, string? selector = null) {
+			if (children.size == 0) {
+				return Metadata.empty;
+			}
+			if (match_cache == null) {
+				index_children ();
+			}
+
+			var key = "%s/%s".printf (selector ?? "", name);
+			var result = match_cache[key];
+			if (result == null) {
+				result = match_child_uncached (name, selector);
+				match_cache[key] = result;
+			}
+			return result;
+		}
+
+		Metadata match_child_uncached (string name, string? selector) {
+			// only children named name or with a pattern prefix of name can match
+			var candidates = new ArrayList<int> ();
+			add_candidates (candidates, literal_children[name]);
+			for (int i = 0; i <= name.length && i <= max_prefix_length; i++) {
+				add_candidates (candidates, prefix_children[name.substring (0, i)]);
+			}
+
 			var result = Metadata.empty;
-			foreach (var metadata in children) {
-				if ((selector == null || metadata.selector == null || metadata.selector == selector) && metadata.pattern_spec.match_string (name)) {
+			foreach (var position in candidates) {
+				var metadata = children[position];
+				if ((selector == null || metadata.selector == null || metadata.selector == selector) && (!metadata.has_wildcard || metadata.pattern_spec.match_string (name))) {
 					metadata.used = true;
 					if (result == Metadata.empty) {
 						// first match
@@ -1246,6 +1325,7 @@ public class Vala.GirParser : CodeVisitor {
 	Namespace glib_ns;
 
 	SourceFile current_source_file;
+	bool skip_docs;
 	Node root;
 	ArrayList<Metadata> metadata_roots = new ArrayList<Metadata> ();
 
@@ -1347,6 +1427,9 @@ public class Vala.GirParser : CodeVisitor {
 		this.current_source_file = source_file;
 		reader = new MarkupReader (source_file.filename);
 
+		// documentation is only used when writing vapi comments
+		skip_docs = !context.vapi_comments;
+
 		// xml prolog
 		next ();
 		next ();
@@ -1898,6 +1981,15 @@ public class Vala.GirParser : CodeVisitor {
 	}
 
 	void skip_element () {
+		if (current_token == MarkupTokenType.START_ELEMENT) {
+			// let the reader scan for the end tag without decoding the content
+			if (!reader.skip_element ()) {
+				Report.error (get_current_src (), "unexpected end of file");
+			}
+			next ();
+			return;
+		}
+
 		next ();
 
 		int level = 1;
@@ -2185,7 +2277,9 @@ public class Vala.GirParser : CodeVisitor {
 		while (current_token == MarkupTokenType.START_ELEMENT) {
 			unowned string reader_name = reader.name;
 
-			if (reader_name == "doc") {
+			if (reader_name == "doc" && skip_docs) {
+				skip_element ();
+			} else if (reader_name == "doc") {
 				start_element ("doc");
 				next ();
 
@@ -2212,7 +2306,9 @@ public class Vala.GirParser : CodeVisitor {
 		while (current_token == MarkupTokenType.START_ELEMENT) {
 			unowned string reader_name = reader.name;
 
-			if (reader_name == "doc") {
+			if (reader_name == "doc" && skip_docs) {
+				skip_element ();
+			} else if (reader_name == "doc") {
 				start_element ("doc");
 				next ();
 
@@ -239,6 +239,21 @@ public class Vala.LambdaExpression : Expression {
 		value_type = new MethodType (method);
 		value_type.value_owned = target_type.value_owned;
 
+		var assignment = parent_node as Assignment;
+		if (target_type.value_owned || ((DelegateType) target_type).is_called_once
+		    || (assignment != null && assignment.left.symbol_reference is Signal)) {
+			// closure data of enclosing blocks is referenced beyond the current call,
+			// including blocks captured through enclosing lambda expressions
+			var sym = context.analyzer.current_symbol;
+			while (sym is Block || (sym is Method && sym.parent_symbol is Block)) {
+				var block = sym as Block;
+				if (block != null) {
+					block.escaping = true;
+				}
+				sym = sym.parent_symbol;
+			}
+		}
+
 		return !error;
 	}
 
@@ -30,6 +30,25 @@ public class Vala.LocalVariable : Variable {
 
 	public bool captured { get; set; }
 
+	/**
+	 * Specifies whether strings are appended to this variable with `+='.
+	 */
+	public bool string_append { get; set; }
+
+	/**
+	 * Specifies whether this variable is passed as ref or out argument or
+	 * whether its address is taken.
+	 */
+	public bool address_taken { get; set; }
+
+	/**
+	 * Returns whether strings appended to this variable are written into
+	 * its buffer in place.
+	 */
+	public bool is_appendable_string () {
+		return string_append && !captured && !address_taken;
+	}
+
 	/* Currently ignored due to GCC 4.8 being strict on possibly uninitialized variables */
 	public bool no_init { get; set; }
 
@@ -207,6 +207,86 @@ public class Vala.MarkupReader : Object {
 		return type;
 	}
 
+	/**
+	 * Skips the element whose start tag has just been read, up to and
+	 * including its end tag, without decoding text or attributes.
+	 *
+	 * @return false if the end of the file was reached first
+	 */
+	public bool skip_element () {
+		attributes.clear ();
+
+		if (empty_element) {
+			empty_element = false;
+			return true;
+		}
+
+		char* last_linebreak = null;
+		char* skip_begin = current;
+		int level = 1;
+		bool in_tag = false;
+		char quote = '\0';
+
+		while (current < end) {
+			char c = current[0];
+			if (c == '\n') {
+				line++;
+				last_linebreak = current;
+			} else if (quote != '\0') {
+				if (c == quote) {
+					quote = '\0';
+				}
+			} else if (in_tag) {
+				if (c == '"' || c == '\'') {
+					quote = c;
+				} else if (c == '>') {
+					in_tag = false;
+					if ((current - 1)[0] == '/') {
+						// empty element
+						level--;
+					}
+					if (level == 0) {
+						current++;
+						break;
+					}
+				}
+			} else if (c == '<') {
+				if (current + 3 < end && current[1] == '!' && current[2] == '-' && current[3] == '-') {
+					// comments may contain unbalanced markup
+					current += 4;
+					while (current + 2 < end && !(current[0] == '-' && current[1] == '-' && current[2] == '>')) {
+						if (current[0] == '\n') {
+							line++;
+							last_linebreak = current;
+						}
+						current++;
+					}
+					current += 2;
+				} else {
+					in_tag = true;
+					if (current + 1 < end && current[1] == '/') {
+						level--;
+					} else if (current + 1 < end && current[1] != '?' && current[1] != '!') {
+						level++;
+					}
+				}
+			}
+			current++;
+		}
+		if (current > end) {
+			// unterminated comment
+			current = end;
+		}
+
+		if (last_linebreak != null) {
+			column = (int) (current - last_linebreak);
+		} else {
+			column += (int) (current - skip_begin);
+		}
+
+		return level == 0;
+	}
+
 	string text (char end_char, bool rm_trailing_whitespace) {
 		StringBuilder content = new StringBuilder ();
 		char* text_begin = current;
@@ -179,13 +179,19 @@ public class Vala.Method : Subroutine {
 
 	public bool closure { get; set; }
 
+	/**
+	 * Specifies whether this method is overridden by a subclass in the
+	 * compiled sources.
+	 */
+	public bool overridden { get; set; }
+
 	public bool coroutine { get; set; }
 
 	public bool is_async_callback { get; set; }
 
 	public int yield_count { get; set; }
 
-	private List<Parameter> parameters = new ArrayList<Parameter> ();
+	private List<Parameter> parameters = new SmallList<Parameter> ();
 	private List<Expression> preconditions;
 	private List<Expression> postconditions;
 	private DataType _return_type;
@@ -328,16 +334,15 @@ public class Vala.Method : Subroutine {
 			return false;
 		}
 		
-		Iterator<Parameter> method_params_it = parameters.iterator ();
 		int param_index = 1;
 		foreach (Parameter base_param in base_method.parameters) {
 			/* this method may not expect less arguments */
-			if (!method_params_it.next ()) {
+			if (param_index > parameters.size) {
 				invalid_match = "too few parameters";
 				return false;
 			}
 
-			var param = method_params_it.get ();
+			var param = parameters[param_index - 1];
 			if (base_param.ellipsis != param.ellipsis) {
 				invalid_match = "ellipsis parameter mismatch";
 				return false;
@@ -358,7 +363,7 @@ public class Vala.Method : Subroutine {
 		}
 		
 		/* this method may not expect more arguments */
-		if (method_params_it.next ()) {
+		if (param_index <= parameters.size) {
 			invalid_match = "too many parameters";
 			return false;
 		}
@@ -109,6 +109,26 @@ public class Vala.ObjectType : ReferenceType {
 			return false;
 		}
 
+		var cl = type_symbol as Class;
+		if (cl != null && cl.is_specialized) {
+			foreach (DataType type_arg in get_type_arguments ()) {
+				if (!is_specializable_type_argument (type_arg)) {
+					Report.error (source_reference, "type argument `%s' of specialized class `%s' requires memory management".printf (type_arg.to_string (), cl.get_full_name ()));
+					return false;
+				}
+			}
+		}
+
 		return true;
 	}
+
+	static bool is_specializable_type_argument (DataType type_arg) {
+		if (type_arg is PointerType || !type_arg.value_owned) {
+			return true;
+		} else if (type_arg is GenericType) {
+			var cl = type_arg.type_parameter.parent_symbol as Class;
+			return cl != null && cl.is_specialized;
+		}
+		return type_arg is ValueType && !type_arg.nullable && !type_arg.is_real_struct_type ();
+	}
 }
@@ -58,6 +58,79 @@ public class Vala.Template : Expression {
 		}
 	}
 
+	/**
+	 * Returns the printf conversion equivalent to calling to_string () on
+	 * values of the specified type, or null if there is none.
+	 */
+	static string? get_format_conversion (CodeContext context, DataType? type) {
+		if (type == null || type.nullable) {
+			return null;
+		}
+		if (type.data_type == context.analyzer.string_type.data_type) {
+			// printf would print null strings as "(null)", so only
+			// use %s where the type system rules out null
+			return context.experimental_non_null ? "%s" : null;
+		}
+
+		var to_string_method = type.get_member ("to_string") as Method;
+		if (to_string_method == null || to_string_method.get_attribute_string ("CCode", "cname") != "g_strdup_printf") {
+			return null;
+		}
+		var params = to_string_method.get_parameters ();
+		if (params.size != 1) {
+			return null;
+		}
+		var format = params[0].initializer as StringLiteral;
+		if (format == null) {
+			return null;
+		}
+		var conversion = format.value.substring (1, format.value.length - 2);
+		if (conversion == "%c") {
+			// a nul character would end the whole result
+			return null;
+		}
+		return conversion;
+	}
+
+	/**
+	 * Builds a single printf call for the whole template, so that the
+	 * resulting string is allocated at once instead of converting each
+	 * value to a temporary string and concatenating those.
+	 */
+	Expression? build_printf_call (CodeContext context) {
+		var format = new StringBuilder ();
+		var args = new ArrayList<Expression> ();
+
+		foreach (var expr in expression_list) {
+			var literal = expr as StringLiteral;
+			if (literal != null) {
+				format.append (literal.value.substring (1, literal.value.length - 2).replace ("%", "%%"));
+				continue;
+			}
+
+			if (!expr.check (context)) {
+				return null;
+			}
+			var conversion = get_format_conversion (context, expr.value_type);
+			if (conversion == null) {
+				return null;
+			}
+			format.append (conversion);
+			args.add (expr);
+		}
+
+		if (args.size == 0) {
+			return null;
+		}
+
+		var format_literal = new StringLiteral ("\"%s\"".printf (format.str), source_reference);
+		var printf_call = new MethodCall (new MemberAccess (format_literal, "printf", source_reference), source_reference);
+		foreach (var arg in args) {
+			printf_call.add_argument (arg);
+		}
+		return printf_call;
+	}
+
 	public override bool check (CodeContext context) {
 		if (checked) {
 			return !error;
@@ -70,13 +143,16 @@ public class Vala.Template : Expression {
 		if (expression_list.size == 0) {
 			expr = new StringLiteral ("\"\"", source_reference);
 		} else {
-			expr = stringify (expression_list[0]);
-			if (expression_list.size > 1) {
-				var concat = new MethodCall (new MemberAccess (expr, "concat", source_reference), source_reference);
-				for (int i = 1; i < expression_list.size; i++) {
-					concat.add_argument (stringify (expression_list[i]));
+			expr = build_printf_call (context);
+			if (expr == null) {
+				expr = stringify (expression_list[0]);
+				if (expression_list.size > 1) {
+					var concat = new MethodCall (new MemberAccess (expr, "concat", source_reference), source_reference);
+					for (int i = 1; i < expression_list.size; i++) {
+						concat.add_argument (stringify (expression_list[i]));
+					}
+					expr = concat;
 				}
-				expr = concat;
 			}
 		}
 		expr.target_type = target_type;
@@ -231,6 +231,11 @@ public class Vala.UnaryExpression : Expression {
 				// ref and out can only be used with fields, parameters, local variables, and array element access
 				lvalue = true;
 				value_type = inner.value_type;
+
+				var local = inner.symbol_reference as LocalVariable;
+				if (local != null) {
+					local.address_taken = true;
+				}
 			} else {
 				error = true;
 				Report.error (source_reference, "ref and out method arguments can only be used with fields, parameters, local variables, and array element access");
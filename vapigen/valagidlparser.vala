@@ -36,14 +36,44 @@ public class Vala.GIdlParser : CodeVisitor {
 	
 	private Namespace current_namespace;
 	private TypeSymbol current_data_type;
-	private Map<string,string> codenode_attributes_map;
-	private Map<PatternSpec*,string> codenode_attributes_patterns;
+	// metadata entries by name or pattern
+	private Map<string,MetadataEntry> codenode_attributes_map;
+	// pattern entries grouped by their literal prefix
+	private Map<string,ArrayList<MetadataEntry>> codenode_attributes_patterns;
+	// matching entry of every code node looked up so far, null if none
+	private Map<string,MetadataEntry?> codenode_attributes_cache;
 	private Set<string> current_type_symbol_set;
 
 	private Map<string,TypeSymbol> cname_type_map;
 
 	static GLib.Regex type_from_string_regex;
 
+	class MetadataEntry {
+		public string name;
+		public string? attributes;
+		public PatternSpec? pattern;
+		// position in the metadata file, earlier patterns take precedence
+		public int index;
+		public bool has_dot;
+		public bool has_colon;
+
+		string[]? parsed_attributes;
+
+		public MetadataEntry (string name, int index) {
+			this.name = name;
+			this.index = index;
+			has_dot = (-1 != name.index_of_char ('.'));
+			has_colon = (-1 != name.index_of_char (':'));
+		}
+
+		public string[]? get_attributes () {
+			if (parsed_attributes == null && attributes != null) {
+				parsed_attributes = parse_attributes (attributes);
+			}
+			return parsed_attributes;
+		}
+	}
+
 	/**
 	 * Parse all source files in the specified code context and build a
 	 * code tree.
@@ -104,14 +134,16 @@ public class Vala.GIdlParser : CodeVisitor {
 
 		current_source_file = source_file;
 
-		codenode_attributes_map = new HashMap<string,string> (str_hash, str_equal);
-		codenode_attributes_patterns = new HashMap<PatternSpec*,string> (direct_hash, (EqualFunc) PatternSpec.equal);
+		codenode_attributes_map = new HashMap<string,MetadataEntry> (str_hash, str_equal);
+		codenode_attributes_patterns = new HashMap<string,ArrayList<MetadataEntry>> (str_hash, str_equal);
+		codenode_attributes_cache = new HashMap<string,MetadataEntry?> (str_hash, str_equal);
 
 		if (FileUtils.test (metadata_filename, FileTest.EXISTS)) {
 			try {
 				string metadata;
 				FileUtils.get_contents (metadata_filename, out metadata, null);
 				
+				int index = 0;
 				foreach (string line in metadata.split ("\n")) {
 					if (line.has_prefix ("#")) {
 						// ignore comment lines
@@ -124,12 +156,26 @@ public class Vala.GIdlParser : CodeVisitor {
 						continue;
 					}
 
-					if (-1 != tokens[0].index_of_char ('*')) {
-						PatternSpec* pattern = new PatternSpec (tokens[0]);
-						codenode_attributes_patterns[pattern] = tokens[0];
+					// later lines for the same name replace the attributes
+					var entry = codenode_attributes_map[tokens[0]];
+					if (entry == null) {
+						entry = new MetadataEntry (tokens[0], index++);
+						codenode_attributes_map[tokens[0]] = entry;
+
+						int wildcard = tokens[0].index_of_char ('*');
+						if (-1 != wildcard) {
+							entry.pattern = new PatternSpec (tokens[0]);
+
+							var prefix = tokens[0].substring (0, wildcard);
+							var prefix_entries = codenode_attributes_patterns[prefix];
+							if (prefix_entries == null) {
+								prefix_entries = new ArrayList<MetadataEntry> ();
+								codenode_attributes_patterns[prefix] = prefix_entries;
+							}
+							prefix_entries.add (entry);
+						}
 					}
-					
-					codenode_attributes_map[tokens[0]] = tokens[1];
+					entry.attributes = tokens[1];
 				}
 			} catch (FileError e) {
 				Report.error (null, "Unable to read metadata file: %s".printf (e.message));
@@ -2952,32 +2998,62 @@ public class Vala.GIdlParser : CodeVisitor {
 		return field;
 	}
 
-	private string[]? get_attributes (string codenode) {
-		var attributes = codenode_attributes_map.get (codenode);
+	private MetadataEntry? find_metadata_entry (string codenode) {
+		var entry = codenode_attributes_map.get (codenode);
+		if (entry != null && entry.attributes != null) {
+			return entry;
+		}
 
-		if (attributes == null) {
-			var dot_required = (-1 != codenode.index_of_char ('.'));
-			var colon_required = (-1 != codenode.index_of_char (':'));
+		var has_dot = (-1 != codenode.index_of_char ('.'));
+		var has_colon = (-1 != codenode.index_of_char (':'));
 
-			var pattern_specs = codenode_attributes_patterns.get_keys ();
-			foreach (PatternSpec* pattern in pattern_specs) {
-				var pspec = codenode_attributes_patterns[pattern];
+		// only patterns whose literal prefix is a prefix of the name can match
+		MetadataEntry? match = null;
+		for (int i = 0; i <= codenode.length; i++) {
+			var prefix_entries = codenode_attributes_patterns.get (codenode.substring (0, i));
+			if (prefix_entries == null) {
+				continue;
+			}
+
+			foreach (var pattern_entry in prefix_entries) {
+				if (match != null && match.index < pattern_entry.index) {
+					break;
+				}
 
-				if ((dot_required && -1 == pspec.index_of_char ('.')) ||
-				    (colon_required && -1 == pspec.index_of_char (':'))) {
+				if ((has_dot && !pattern_entry.has_dot) ||
+				    (has_colon && !pattern_entry.has_colon)) {
 					continue;
 				}
 
-				if (pattern->match_string (codenode)) {
-					return get_attributes (pspec);
+				if (pattern_entry.pattern.match_string (codenode)) {
+					match = pattern_entry;
+					break;
 				}
 			}
 		}
 
-		if (attributes == null) {
+		if (match != null && match.attributes == null) {
 			return null;
 		}
+		return match;
+	}
+
+	private string[]? get_attributes (string codenode) {
+		MetadataEntry? entry;
+		if (codenode_attributes_cache.contains (codenode)) {
+			entry = codenode_attributes_cache.get (codenode);
+		} else {
+			entry = find_metadata_entry (codenode);
+			codenode_attributes_cache[codenode] = entry;
+		}
+
+		if (entry == null) {
+			return null;
+		}
+		return entry.get_attributes ();
+	}
 
+	static string[] parse_attributes (string attributes) {
 		GLib.SList<string> attr_list = new GLib.SList<string> ();
 		var attr = new GLib.StringBuilder.sized (attributes.length);
 		var attributes_len = attributes.length;
@@ -38,8 +38,18 @@ class Vala.VAPIGen : Object {
 	static string library;
 	[CCode (array_length = false, array_null_terminated = true)]
 	static string[] packages;
+	static string batch_file;
+	static int jobs = 1;
 	CodeContext context;
 
+	// batch mode state
+	MainLoop batch_loop;
+	ArrayList<string> batch_commands;
+	string[] batch_args;
+	int batch_next;
+	int batch_running;
+	int batch_failed;
+
 	const OptionEntry[] options = {
 		{ "vapidir", 0, 0, OptionArg.FILENAME_ARRAY, ref vapi_directories, "Look for package bindings in DIRECTORY", "DIRECTORY..." },
 		{ "girdir", 0, 0, OptionArg.FILENAME_ARRAY, ref gir_directories, "Look for GIR bindings in DIRECTORY", "DIRECTORY..." },
@@ -50,6 +60,8 @@ class Vala.VAPIGen : Object {
 		{ "disable-warnings", 0, 0, OptionArg.NONE, ref disable_warnings, "Disable warnings", null },
 		{ "version", 0, 0, OptionArg.NONE, ref version, "Display version number", null },
 		{ "quiet", 'q', 0, OptionArg.NONE, ref quiet_mode, "Do not print messages to the console", null },
+		{ "batch", 0, 0, OptionArg.FILENAME, ref batch_file, "Generate the bindings listed in FILE, one set of arguments per line", "FILE" },
+		{ "jobs", 'j', 0, OptionArg.INT, ref jobs, "Generate up to N bindings in parallel in batch mode", "N" },
 		{ "", 0, 0, OptionArg.FILENAME_ARRAY, ref sources, null, "FILE..." },
 		{ null }
 	};
@@ -196,6 +208,104 @@ class Vala.VAPIGen : Object {
 		return quit ();
 	}
 	
+	private void start_batch_jobs () {
+		while (batch_running < jobs && batch_next < batch_commands.size) {
+			var command = batch_commands[batch_next++];
+
+			try {
+				string[] command_args;
+				Shell.parse_argv (command, out command_args);
+
+				string[] argv = batch_args;
+				foreach (string arg in command_args) {
+					argv += arg;
+				}
+
+				Pid pid;
+				Process.spawn_async (null, argv, null, SpawnFlags.SEARCH_PATH | SpawnFlags.DO_NOT_REAP_CHILD, null, out pid);
+				batch_running++;
+
+				ChildWatch.add (pid, (pid, status) => {
+					Process.close_pid (pid);
+					if (status != 0) {
+						stderr.printf ("Generation failed: %s\n", command);
+						batch_failed++;
+					}
+					batch_running--;
+					start_batch_jobs ();
+				});
+			} catch (Error e) {
+				stderr.printf ("%s: %s\n", command, e.message);
+				batch_failed++;
+			}
+		}
+
+		if (batch_running == 0) {
+			batch_loop.quit ();
+		}
+	}
+
+	/**
+	 * Runs a separate generator process for every line of the batch
+	 * file, keeping up to jobs processes running at the same time.
+	 */
+	private int run_batch (string program) {
+		string contents;
+		try {
+			FileUtils.get_contents (batch_file, out contents);
+		} catch (FileError e) {
+			stderr.printf ("%s\n", e.message);
+			return 1;
+		}
+
+		batch_commands = new ArrayList<string> ();
+		foreach (string line in contents.split ("\n")) {
+			var command = line.strip ();
+			if (command != "" && !command.has_prefix ("#")) {
+				batch_commands.add (command);
+			}
+		}
+
+		// options given on the command line apply to every binding
+		batch_args = { program };
+		foreach (string dir in vapi_directories) {
+			batch_args += "--vapidir=" + dir;
+		}
+		foreach (string dir in gir_directories) {
+			batch_args += "--girdir=" + dir;
+		}
+		foreach (string dir in metadata_directories) {
+			batch_args += "--metadatadir=" + dir;
+		}
+		if (directory != null) {
+			batch_args += "--directory=" + directory;
+		}
+		if (disable_warnings) {
+			batch_args += "--disable-warnings";
+		}
+		if (quiet_mode) {
+			batch_args += "--quiet";
+		}
+
+		if (jobs < 1) {
+			jobs = 1;
+		}
+
+		batch_loop = new MainLoop ();
+		start_batch_jobs ();
+		if (batch_running > 0) {
+			batch_loop.run ();
+		}
+
+		if (batch_failed > 0) {
+			if (!quiet_mode) {
+				stdout.printf ("Batch generation failed: %d of %d binding(s)\n", batch_failed, batch_commands.size);
+			}
+			return 1;
+		}
+		return 0;
+	}
+
 	static int main (string[] args) {
 		try {
 			var opt_context = new OptionContext ("- Vala API Generator");
@@ -213,6 +323,10 @@ class Vala.VAPIGen : Object {
 			return 0;
 		}
 
+		if (batch_file != null) {
+			return new VAPIGen ().run_batch (args[0]);
+		}
+
 		if (sources == null) {
 			stderr.printf ("No source file specified.\n");
 			return 1;